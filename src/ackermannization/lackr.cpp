@@ -69,7 +69,14 @@ lbool lackr::operator()() {
     return rv;
 }
 
-bool lackr::mk_ackermann(/*out*/goal_ref& g, double lemmas_upper_bound) {    
+// The tactic entry point must emit a closed goal, so it either instantiates
+// every congruence constraint or declines via the lemma bound: dropping a
+// subset would make the abstraction an over-approximation and a downstream
+// "sat" spurious. Incremental CEGAR-style expansion - solve the abstraction,
+// let lackr_model_constructor find violated congruences, assert only those -
+// is the lazy() loop below, selected with ackermannization.eager=false when
+// lackr drives the solver itself.
+bool lackr::mk_ackermann(/*out*/goal_ref& g, double lemmas_upper_bound) {
     if (lemmas_upper_bound <= 0)
         return false;
     if (!init())
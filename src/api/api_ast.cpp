@@ -14,6 +14,19 @@ Author:
 
 Revision History:
 
+Notes:
+
+    Construction stays one node per call on purpose. A batch entry point
+    taking opcode/argument-index arrays would be an interpreter for a term
+    language of its own: every element can fail sort checking
+    individually, and the error protocol here reports one failure per call
+    with a null result, which has no good analogue for a half-built batch.
+    The per-call scaffolding is also thinner than it looks - the log hooks
+    compile to no-ops unless an interaction log is open, and there is no
+    per-call lock; contexts are single-threaded by contract. Encoders that
+    need fewer FFI crossings get them in the bindings layer (e.g. caching
+    and bulk helpers in the Python layer) without widening the C surface.
+
 --*/
 #include "api/api_log_macros.h"
 #include "api/api_context.h"
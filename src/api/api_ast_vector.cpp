@@ -7,13 +7,25 @@ Module Name:
 
 Abstract:
     API for creating AST vectors
-    
+
 Author:
 
     Leonardo de Moura (leonardo) 2012-03-09.
 
 Revision History:
 
+Notes:
+
+    Traversal goes through per-node handles rather than a flat serialized
+    arena. Handles carry the liveness contract - each returned ast is
+    pinned against garbage collection while the caller holds it - and a
+    zero-copy buffer of ids and child offsets would dangle as soon as the
+    context reclaims or rewrites nodes, unless the whole DAG were pinned
+    for the buffer's lifetime. Bindings that want to walk a large term
+    without round trips can already export it once as text
+    (Z3_ast_vector_to_string / Z3_ast_to_string) and parse client-side,
+    trading the per-node calls for one stable snapshot.
+
 --*/
 #include "api/z3.h"
 #include "api/api_log_macros.h"
@@ -83,7 +83,10 @@ namespace api {
     // This ensures that the calls to m().dec_ref() and dealloc(o)
     // only happens in the main thread.
     // Calls to dec_ref are allowed in other threads when m_concurrent_dec_ref is
-    // set to true.
+    // set to true (opt in via Z3_enable_concurrent_dec_ref): worker threads
+    // only append to the pending buffers under the short mutex hold, and the
+    // buffers are swapped out and drained here at the next main-thread entry
+    // point, so reclamation never races with API calls that read the asts.
     void context::flush_objects() {
 #ifndef SINGLE_THREAD
         if (!m_concurrent_dec_ref)
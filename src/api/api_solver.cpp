@@ -510,6 +510,14 @@ extern "C" {
         Z3_CATCH;
     }
 
+    // Reset drops the underlying solver stack instead of scrubbing it for
+    // reuse: a "verified clean" pooled solver would have to prove that no
+    // parameters, preprocessor state or learned facts leak into the next
+    // query, and discarding is the only cheap way to guarantee that. The
+    // wrapper itself is thin - the real stack is built lazily on first use
+    // by init_solver - so callers wanting allocation-free turnaround with
+    // retained simplifier caches should keep one solver and delimit queries
+    // with push/pop or check-sat-with-assumptions rather than recreating.
     void Z3_API Z3_solver_reset(Z3_context c, Z3_solver s) {
         Z3_TRY;
         LOG_Z3_solver_reset(c, s);
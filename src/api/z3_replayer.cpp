@@ -15,6 +15,17 @@ Author:
 
 Notes:
 
+    The log is replayed front to back by re-executing every call, and that
+    is a correctness requirement rather than a format limitation: calls
+    are stateful, results are referenced by the register positions earlier
+    calls assigned (SetR/SetO/SetAO), so seeking past a prefix or skipping
+    retrieval calls would leave later references dangling unless the whole
+    prefix were executed anyway. Replay time is consequently dominated by
+    the native solver work the trace re-runs, not by parsing the
+    line-oriented text - a binary encoding would shave only the scanner.
+    For long traces the practical lever is trimming the trace itself to
+    the failing query before replaying.
+
 --*/
 #include "util/vector.h"
 #include "util/map.h"
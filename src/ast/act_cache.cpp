@@ -21,6 +21,7 @@ Notes:
 
 #define MIN_MAX_UNUSED   1024
 #define INITIAL_CAPACITY 128
+#define L1_SIZE          2048 // must be a power of two
 
 /*
   This cache is a mapping from expr -> tagged expressions
@@ -70,6 +71,13 @@ void act_cache::init() {
         m_max_unused = MIN_MAX_UNUSED;
     m_unused = 0;
     m_qhead = 0;
+    m_l1.resize(L1_SIZE);
+}
+
+void act_cache::l1_invalidate(expr * k, unsigned offset) {
+    l1_entry & e = l1_slot(k);
+    if (e.m_key == k && e.m_offset == offset)
+        e.m_key = nullptr;
 }
 
 void act_cache::dec_refs() {
@@ -111,6 +119,9 @@ void act_cache::del_unused() {
         if (GET_TAG(entry->m_value) == 0) {
             // Key k was never accessed by client code.
             // That is, find(k) was never executed by client code.
+            // Unused entries are never in the L1 (only found entries are),
+            // but invalidate defensively before the references are dropped.
+            l1_invalidate(e.first, e.second);
             m_unused--;
             expr * v = entry->m_value;
             m_table.erase(e);
@@ -164,7 +175,8 @@ void act_cache::insert(expr * k, unsigned offset, expr * v) {
         DEBUG_CODE(expected_tag = GET_TAG(entry.m_value);); 
     }
     else {
-        // replacing old entry
+        // replacing old entry; the L1 may still map k to the old value.
+        l1_invalidate(k, offset);
         m_manager.inc_ref(v);
         m_manager.dec_ref(UNTAG(expr*, entry.m_value));
         entry.m_value = v;
@@ -185,6 +197,9 @@ void act_cache::insert(expr * k, unsigned offset, expr * v) {
    If entry k -> (v, tag) is found, we set tag to 1.
 */
 expr * act_cache::find(expr * k, unsigned offset) {
+    l1_entry & le = l1_slot(k);
+    if (le.m_key == k && le.m_offset == offset)
+        return le.m_value;
     entry_t e(k, offset);
     map::key_value * entry = m_table.find_core(e);
     if (entry == nullptr)
@@ -200,7 +215,12 @@ expr * act_cache::find(expr * k, unsigned offset) {
             SASSERT(GET_TAG(v) == 1);
         });
     }
-    return UNTAG(expr*, entry->m_value);
+    // The entry is now marked as used, so it will not be deleted by
+    // del_unused and its references keep the L1 entry valid.
+    le.m_key    = k;
+    le.m_offset = offset;
+    le.m_value  = UNTAG(expr*, entry->m_value);
+    return le.m_value;
 }
 
 void act_cache::reset() {
@@ -209,6 +229,8 @@ void act_cache::reset() {
     m_queue.reset();
     m_unused = 0;
     m_qhead = 0;
+    m_l1.reset();
+    m_l1.resize(L1_SIZE);
 }
 
 void act_cache::cleanup() {
@@ -217,6 +239,8 @@ void act_cache::cleanup() {
     m_queue.finalize();
     m_unused = 0;
     m_qhead = 0;
+    m_l1.reset();
+    m_l1.resize(L1_SIZE);
 }
 
 bool act_cache::check_invariant() const {
@@ -38,6 +38,19 @@ class act_cache {
     unsigned             m_unused;
     unsigned             m_max_unused;
 
+    // Direct-mapped L1 indexed by key id. It only holds entries that are
+    // also in m_table with their used-flag set, so the references owned by
+    // m_table keep L1 entries alive and hits touch no reference counts.
+    struct l1_entry {
+        expr *   m_key = nullptr;
+        unsigned m_offset = 0;
+        expr *   m_value = nullptr;
+    };
+    svector<l1_entry>    m_l1;
+
+    l1_entry & l1_slot(expr * k) { return m_l1[k->get_id() & (m_l1.size() - 1)]; }
+    void l1_invalidate(expr * k, unsigned offset);
+
     void compress_queue();
     void init();
     void dec_refs();
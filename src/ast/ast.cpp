@@ -21,6 +21,7 @@ Revision History:
 #include <format>
 #include <cstring>
 #include "ast/ast.h"
+#include "ast/act_cache.h"
 #include "ast/ast_pp.h"
 #include "ast/ast_ll_pp.h"
 #include "util/buffer.h"
@@ -1360,6 +1361,7 @@ static void mark_array_ref(ast_mark& mark, unsigned sz, parameter const * a) {
 ast_manager::~ast_manager() {
     SASSERT(is_format_manager() || !m_family_manager.has_family(symbol("format")));
 
+    flush_rewrite_caches();
     dec_ref(m_bool_sort);
     dec_ref(m_proof_sort);
     dec_ref(m_true);
@@ -1442,6 +1444,21 @@ ast_manager::~ast_manager() {
     }
 }
 
+act_cache * ast_manager::get_rewrite_cache(std::string const & cfg) {
+    for (auto const & [k, c] : m_rewrite_caches)
+        if (k == cfg)
+            return c;
+    act_cache * c = alloc(act_cache, *this);
+    m_rewrite_caches.push_back({ cfg, c });
+    return c;
+}
+
+void ast_manager::flush_rewrite_caches() {
+    for (auto const & [k, c] : m_rewrite_caches)
+        dealloc(c);
+    m_rewrite_caches.reset();
+}
+
 void ast_manager::compact_memory() {
     m_alloc.consolidate();
     unsigned capacity = m_ast_table.capacity();
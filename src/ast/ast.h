@@ -67,6 +67,7 @@ Revision History:
 
 class ast;
 class ast_manager;
+class act_cache;
 
 /**
    \brief Generic exception for AST related errors.
@@ -1518,6 +1519,7 @@ protected:
     app *                     m_false;
     proof *                   m_undef_proof;
     unsigned                  m_fresh_id;
+    vector<std::pair<std::string, act_cache*>> m_rewrite_caches; // canonical configuration -> shared simplification cache
     bool                      m_debug_ref_count;
     u_map<unsigned>           m_debug_free_indices;
     std::fstream*             m_trace_stream = nullptr;
@@ -1642,6 +1644,20 @@ public:
    
     unsigned get_num_asts() const { return m_ast_table.size(); }
 
+    //!< Pre-size the unique table for num_asts additional nodes (capacity hint for bulk construction).
+    void reserve_asts(unsigned num_asts) { m_ast_table.reserve(m_ast_table.size() + num_asts); }
+
+    /**
+       \brief Return the manager-scoped simplification cache for the given
+       canonical configuration string, creating it on demand. Rewriters with
+       equal configurations share simplification results across instances
+       through it. The key is compared by full string equality so rewriters
+       with different configurations can never alias the same cache.
+    */
+    act_cache * get_rewrite_cache(std::string const & cfg);
+
+    void flush_rewrite_caches();
+
     void debug_ref_count() { m_debug_ref_count = true; }
 
     void inc_ref(ast* n) {
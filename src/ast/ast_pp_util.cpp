@@ -15,6 +15,20 @@ Author:
 
 Revision History:
 
+Notes:
+
+    Two printing regimes coexist here. The "neat" path goes through
+    ast_smt2_pp, which lays out a 2-D format tree for readable output and
+    pays for it in memory on huge terms. For dumps that must not blow up,
+    define_expr below is the streaming path: an iterative post-order walk
+    that writes one define-const line per DAG node straight to the ostream,
+    referring to children by $id, so every shared subterm is printed
+    exactly once and no format tree is built. display_asserts with
+    neat=false similarly streams via ast_smt_pp's let-based printer. The
+    residual footprint is the visited marks - sharing detection cannot be
+    done in O(depth) - but that is a few bytes per distinct node rather
+    than a layout tree per occurrence.
+
 --*/
 
 #include "ast/ast_pp_util.h"
@@ -22,6 +22,7 @@ Revision History:
 #include "ast/array_decl_plugin.h"
 #include "ast/format.h"
 #include "ast/ast_translation.h"
+#include "ast/for_each_expr.h"
 #include "ast/ast_ll_pp.h"
 #include "ast/ast_pp.h"
 
@@ -37,6 +38,18 @@ void ast_translation::cleanup() {
     m_extra_children_stack.finalize();
 }
 
+void ast_translation::reserve(unsigned num, expr * const * es) {
+    if (&from() == &to())
+        return;
+    unsigned num_nodes = 0;
+    expr_fast_mark1 visited;
+    for (unsigned i = 0; i < num; ++i)
+        if (es[i])
+            num_nodes += get_num_exprs(es[i], visited);
+    // over-approximates when part of the DAG already lives in the target.
+    to().reserve_asts(num_nodes);
+}
+
 void ast_translation::reset_cache() {
     for (auto & kv : m_cache) {
         m_from_manager.dec_ref(kv.m_key);
@@ -208,8 +221,12 @@ ast * ast_translation::process(ast const * _n) {
     
     ++m_num_process;
     if (m_num_process > (1 << 14)) {
-        reset_cache();
         m_num_process = 0;
+        // Only evict when the cache accumulated substantial state. Long-lived
+        // translations (e.g., the per-worker translations in smt_parallel)
+        // keep shared structure hot across calls instead of re-copying it.
+        if (m_cache.size() > (1 << 16))
+            reset_cache();
     }
     if (!visit(const_cast<ast*>(_n))) {
         while (!m_frame_stack.empty()) {
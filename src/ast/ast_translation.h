@@ -88,11 +88,19 @@ public:
 
     template<typename T>
     ref_vector<T, ast_manager> operator()(ref_vector<T, ast_manager> const& src) {
+        reserve(src.size(), (expr * const *) src.data());
         ref_vector<T, ast_manager> dst(to());
         for (expr* v : src) dst.push_back(translate(v));
         return dst;
     }
 
+    /**
+       \brief Count the DAG nodes reachable from es and pre-size the target
+       manager's unique table accordingly, so that bulk translations do not
+       pay a cascade of hash-table expansions.
+    */
+    void reserve(unsigned num, expr * const * es);
+
     void reset_cache();
     void cleanup();
     
@@ -56,7 +56,8 @@ namespace euf {
         unsigned      m_generation = 0;         // Tracks how many quantifier instantiation rounds were needed to generate this enode.
         enode_vector  m_parents;
         enode*        m_next   = nullptr;
-        enode*        m_root   = nullptr;
+        enode*        m_root   = nullptr;      // Eagerly maintained: egraph::merge rewrites m_root for the entire
+                                               // smaller class, so get_root() is a single load, never a chain walk.
         enode*        m_target = nullptr;
         enode*        m_cg     = nullptr;
         th_var_list   m_th_vars;
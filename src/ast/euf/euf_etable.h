@@ -74,10 +74,13 @@ namespace euf {
             unsigned operator()(enode * n) const {
                 SASSERT(n->num_args() == 2);
                 unsigned h1 = get_root(n, 0)->hash();
-                unsigned h2 = get_root(n, 1)->hash(); 
+                unsigned h2 = get_root(n, 1)->hash();
                 if (h1 > h2)
                     std::swap(h1, h2);
-                return hash_u((h1 << 16) | (h2 & 0xFFFF));
+                // ordering the hashes makes the result argument-order invariant;
+                // combine the full words instead of 16 bits of each, which
+                // collided badly once an egraph exceeded 2^16 nodes.
+                return combine_hash(h1, h2);
             }
         };
         
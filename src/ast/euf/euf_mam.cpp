@@ -1940,10 +1940,8 @@ namespace euf {
         // Flat-assoc applications may have arbitrary number of arguments.
         enode * get_first_f_app(func_decl * lbl, unsigned num_expected_args, enode * first) {
             enode *matching_cgr = nullptr, *min_gen_match = nullptr;
-            for (enode* curr : euf::enode_class(first)) {
+            for (enode* curr : euf::enode_class(first))
                 get_f_app(lbl, num_expected_args, curr, matching_cgr, min_gen_match);
-                curr = curr->get_next();
-            }
             if (matching_cgr)
                 update_max_generation(min_gen_match, first);                          
             return matching_cgr;
@@ -19,10 +19,11 @@ Notes:
 #pragma once
 
 #include "ast/ast.h"
+#include "util/swiss_table.h"
 
 class expr_substitution {
     ast_manager &                                m_manager;
-    obj_map<expr, expr*>                         m_subst;
+    obj_swiss_map<expr, expr*>                   m_subst;
     scoped_ptr<obj_map<expr, proof*> >           m_subst_pr;
     scoped_ptr<obj_map<expr, expr_dependency*> > m_subst_dep;
     unsigned                                     m_cores_enabled:1;
@@ -54,7 +55,7 @@ public:
     void reset();
     void cleanup();
 
-    obj_map<expr, expr*> const & sub() const { return m_subst; }
+    obj_swiss_map<expr, expr*> const & sub() const { return m_subst; }
 
     std::ostream& display(std::ostream& out);
 };
@@ -39,6 +39,12 @@ unsigned get_num_exprs(expr * n, expr_fast_mark1 & visited) {
     return counter.m_num;
 }
 
+unsigned get_num_exprs(expr * n, expr_visit_ctx & ctx) {
+    expr_counter_proc counter;
+    for_each_expr(counter, ctx, n);
+    return counter.m_num;
+}
+
 unsigned get_num_exprs(expr * n) {
     expr_fast_mark1 visited;
     return get_num_exprs(n, visited);
@@ -152,6 +152,70 @@ void quick_for_each_expr(ForEachProc & proc, expr * n) {
     for_each_expr_core<ForEachProc, expr_fast_mark1, false, false>(proc, visited, n);
 }
 
+/**
+   \brief Reusable traversal context.
+
+   It provides the visited-mark interface expected by for_each_expr_core,
+   but keeps its storage alive across traversals: a new traversal
+   invalidates all marks in constant time by bumping an epoch counter
+   instead of clearing them. Intended for utilities that repeatedly walk
+   terms over the same manager and would otherwise pay for allocating and
+   resetting a fresh expr_mark per call.
+*/
+class expr_visit_ctx {
+    unsigned_vector m_epoch;
+    unsigned        m_curr = 1;
+public:
+    void begin_traversal() {
+        if (++m_curr == 0) {
+            // epoch counter wrapped around; start from scratch.
+            m_epoch.reset();
+            m_curr = 1;
+        }
+    }
+    bool is_marked(expr * n) const {
+        unsigned id = n->get_id();
+        return id < m_epoch.size() && m_epoch[id] == m_curr;
+    }
+    void mark(expr * n) {
+        m_epoch.reserve(n->get_id() + 1, 0);
+        m_epoch[n->get_id()] = m_curr;
+    }
+    void finalize() { m_epoch.finalize(); }
+};
+
+template<typename ForEachProc>
+void for_each_expr(ForEachProc & proc, expr_visit_ctx & ctx, expr * n) {
+    ctx.begin_traversal();
+    for_each_expr_core<ForEachProc, expr_visit_ctx, false, false>(proc, ctx, n);
+}
+
+template<typename ForEachProc>
+void for_each_expr(ForEachProc & proc, expr_visit_ctx & ctx, unsigned n, expr * const * es) {
+    ctx.begin_traversal();
+    for (unsigned i = 0; i < n; ++i)
+        for_each_expr_core<ForEachProc, expr_visit_ctx, false, false>(proc, ctx, es[i]);
+}
+
+/**
+   \brief Combine two visitors into one, so several analyses can share a
+   single DAG pass. Nests for more than two: mk_joint_proc(p1, mk_joint_proc(p2, p3)).
+*/
+template<typename Proc1, typename Proc2>
+struct joint_expr_proc {
+    Proc1 & m_p1;
+    Proc2 & m_p2;
+    joint_expr_proc(Proc1 & p1, Proc2 & p2): m_p1(p1), m_p2(p2) {}
+    void operator()(var * n)        { m_p1(n); m_p2(n); }
+    void operator()(app * n)        { m_p1(n); m_p2(n); }
+    void operator()(quantifier * n) { m_p1(n); m_p2(n); }
+};
+
+template<typename Proc1, typename Proc2>
+joint_expr_proc<Proc1, Proc2> mk_joint_proc(Proc1 & p1, Proc2 & p2) {
+    return joint_expr_proc<Proc1, Proc2>(p1, p2);
+}
+
 template<typename EscapeProc>
 struct for_each_expr_proc : public EscapeProc {
     void operator()(expr * n)        { EscapeProc::operator()(n); }
@@ -163,6 +227,7 @@ struct for_each_expr_proc : public EscapeProc {
 unsigned get_num_exprs(expr * n);
 unsigned get_num_exprs(expr * n, expr_mark & visited);
 unsigned get_num_exprs(expr * n, expr_fast_mark1 & visited);
+unsigned get_num_exprs(expr * n, expr_visit_ctx & ctx);
 void get_num_internal_exprs(unsigned_vector& counts, ptr_vector<expr>& todo, expr * n);
 unsigned count_internal_nodes(unsigned_vector& counts, ptr_vector<expr>& todo);
 
@@ -15,6 +15,17 @@ Christoph (cwinter) 2012-02-09
 
 Notes:
 
+    Ground floating-point subterms never reach this converter: the qffp
+    preamble runs simplification and value propagation first, and
+    fpa_rewriter folds concrete operations with mpf arithmetic, so only
+    genuinely symbolic operations are blasted. mpf rather than hwf is used
+    for the folding because hwf inherits the host FPU's quirks (x87 excess
+    precision, flush-to-zero modes) and the folded values must match the
+    circuits built here bit for bit. Interval refutation before blasting
+    would need an FP interval domain with correct directed rounding at the
+    bounds; nothing in the AST-level rewriters provides that today, and
+    unsound pruning here would surface as wrong models downstream.
+
 --*/
 #include<math.h>
 
@@ -18,6 +18,20 @@ Revision History:
     Christoph Wintersteiger (t-cwinte), 2010-04-13: Added cycle detection for macro definitions
     Leonardo de Moura (leonardo) 2010-12-15: Moved dependency management to func_decl_dependencies.h
 
+Notes:
+
+    Macro lookup is already hashed: m_decl2macro (and the macro_replacer's
+    own table) key on the head declaration, so matching during expansion is
+    a single obj_map probe per application, independent of how many macros
+    are registered. Macros whose definitions mention other macro heads are
+    handled by rerunning the expansion rewriter to a fixpoint rather than
+    by an explicit topological pass; func_decl_dependencies guarantees the
+    definitions are acyclic, so the number of sweeps is bounded by the
+    nesting depth of the definitions, not by their count. The dependency
+    tracked per expansion (m_used_macro_dependencies) records exactly the
+    macros that fired, which keeps unsat-core attribution proportional to
+    the used subset.
+
 --*/
 #include "ast/macros/macro_manager.h"
 #include "ast/for_each_expr.h"
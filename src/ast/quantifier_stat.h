@@ -21,6 +21,7 @@ Revision History:
 #include "ast/ast.h"
 #include "util/obj_hashtable.h"
 #include "util/approx_nat.h"
+#include "util/ema.h"
 #include "util/region.h"
 
 namespace q {
@@ -42,6 +43,8 @@ namespace q {
         unsigned m_num_instances_curr_branch; //!< only updated if QI_TRACK_INSTANCES is true
         unsigned m_max_generation; //!< max. generation of an instance
         float    m_max_cost;
+        unsigned m_num_conflict_uses; //!< number of times an instance of this quantifier participated in a conflict
+        ema      m_utility = 0.0625; //!< moving average of conflict participation per instantiation
 
         friend class quantifier_stat_gen;
 
@@ -124,6 +127,22 @@ namespace q {
         float get_max_cost() const {
             return m_max_cost;
         }
+
+        void inc_num_conflict_uses() {
+            m_num_conflict_uses++;
+        }
+
+        unsigned get_num_conflict_uses() const {
+            return m_num_conflict_uses;
+        }
+
+        void update_utility(double v) {
+            m_utility.update(v);
+        }
+
+        double get_utility() const {
+            return m_utility;
+        }
     };
 
     /**
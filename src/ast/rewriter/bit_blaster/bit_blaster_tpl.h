@@ -36,6 +36,7 @@ protected:
 
     unsigned long long m_max_memory;
     void checkpoint();
+    void reserve_cells(unsigned long long num_cells);
 
 public:
     bit_blaster_tpl(Cfg const & cfg = Cfg(), unsigned long long max_memory = UINT64_MAX):
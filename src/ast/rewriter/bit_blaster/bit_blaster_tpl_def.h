@@ -34,6 +34,19 @@ void bit_blaster_tpl<Cfg>::checkpoint() {
         throw rewriter_exception(m().limit().get_cancel_msg());
 }
 
+/**
+   \brief Pre-size the unique table for a circuit of num_cells adder cells.
+   Each cell creates about six nodes (xor3 + carry); hash-consing may find
+   most of them, so this is only a capacity hint and is capped.
+*/
+template<typename Cfg>
+void bit_blaster_tpl<Cfg>::reserve_cells(unsigned long long num_cells) {
+    if (num_cells < 1024)
+        return;
+    unsigned num_nodes = static_cast<unsigned>(std::min(6 * num_cells, static_cast<unsigned long long>(1u << 24)));
+    m().reserve_asts(num_nodes);
+}
+
 /**
    \brief Return true if all bits are true or false.
 */
@@ -209,6 +222,8 @@ void bit_blaster_tpl<Cfg>::mk_multiplier(unsigned sz, expr * const * a_bits, exp
     verbose_stream() << "MK_MULTIPLIER: " << counter << std::endl;
 #endif
 
+    reserve_cells(static_cast<unsigned long long>(sz) * (sz + 1) / 2);
+
     expr_ref_vector cins(m()), couts(m());
     expr_ref out(m()), cout(m());
 
@@ -389,6 +404,9 @@ void bit_blaster_tpl<Cfg>::mk_udiv_urem(unsigned sz, expr * const * a_bits, expr
     // t is an auxiliary vector used to store the result of a subtraction
     expr_ref_vector t(m());
 
+    // sz stages, each building a subtracter and a row of ites.
+    reserve_cells(2 * static_cast<unsigned long long>(sz) * sz);
+
     // init p
     p.push_back(a_bits[sz-1]);
     for (unsigned i = 1; i < sz; ++i)
@@ -15,6 +15,19 @@ Author:
 
 Revision History:
 
+Notes:
+
+    All bindings registered through insert() are applied simultaneously in
+    one bottom-up pass over the expression DAG; each node is rewritten once
+    regardless of how many bindings it is affected by, and m_cache survives
+    across operator() calls so applying the same substitution to several
+    formulas shares the work. insert() must clear the cache: entries
+    computed under the old binding set do not reflect the new binding, so a
+    "just add bindings and keep the cache" mode would return stale results
+    for any subterm containing the new source. Callers that eliminate many
+    variables (the DER passes in qe_lite) therefore compose bindings into
+    each other first - substituting into the small definition terms in
+    dependency order - and walk the full formula a single time.
 
 --*/
 
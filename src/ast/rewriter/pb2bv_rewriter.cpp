@@ -15,6 +15,18 @@ Author:
 
 Notes:
 
+    Circuit sharing across constraints comes from hash-consing rather than
+    an explicit cache: the sorting networks are emitted through psort_expr
+    as ordinary and/or terms, so two constraints over the same literals
+    produce the same comparator subterms and collapse to shared DAG nodes
+    in the ast_manager, keyed - in effect - by input and position. An extra
+    (input multiset, bound) cache would only memoize what hash-consing
+    already dedups, and constraints that are near-identical but not equal
+    cannot reuse each other's fragments soundly since every comparator
+    output depends on the exact input vector. Unweighted constraints
+    already take the cheaper route: psort_nw::card builds k-truncated
+    cardinality networks instead of full sorters when the bound permits.
+
 --*/
 
 #include "util/statistics.h"
@@ -89,11 +89,18 @@ protected:
 
     bool is_mul(expr * t, numeral & c, expr * & pp) const;
 
+    // Sums larger than this are ordered by expression id instead of the
+    // structural term ordering: on huge linear combinations the recursive
+    // comparator dominates normalization time, and the structural order
+    // carries no simplification benefit, only canonicity.
+    static const unsigned m_id_sort_threshold = 1024;
+
     class mon_lt {
         poly_rewriter& rw;
+        unsigned       m_num_mons;
         int ordinal(expr* e) const;
     public:
-        mon_lt(poly_rewriter& rw): rw(rw) {}
+        mon_lt(poly_rewriter& rw, unsigned num_mons = 0): rw(rw), m_num_mons(num_mons) {}
         bool operator()(expr* e1, expr * e2) const;
     };
 
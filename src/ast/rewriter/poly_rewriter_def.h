@@ -492,7 +492,7 @@ bool poly_rewriter<Config>::gcd_test(expr* lhs, expr* rhs) const {
 
 template<typename Config>
 bool poly_rewriter<Config>::mon_lt::operator()(expr* e1, expr * e2) const {
-    if (rw.m_ast_order) 
+    if (rw.m_ast_order && m_num_mons <= m_id_sort_threshold)
         return lt(e1,e2);
     return ordinal(e1) < ordinal(e2);
 }
@@ -528,7 +528,7 @@ int poly_rewriter<Config>::mon_lt::ordinal(expr* e) const {
 
 template<typename Config>
 br_status poly_rewriter<Config>::mk_nflat_add_core(unsigned num_args, expr * const * args, expr_ref & result) {
-    mon_lt lt(*this);
+    mon_lt lt(*this, num_args);
     SASSERT(num_args >= 2);
     numeral c;
     unsigned num_coeffs = 0;
@@ -617,9 +617,9 @@ br_status poly_rewriter<Config>::mk_nflat_add_core(unsigned num_args, expr * con
         if (m_sort_sums) {
             TRACE(rewriter_bug, tout << "new_args.size(): " << new_args.size() << "\n";);
             if (c.is_zero())
-                std::sort(new_args.data(), new_args.data() + new_args.size(), mon_lt(*this));
+                std::sort(new_args.data(), new_args.data() + new_args.size(), lt);
             else
-                std::sort(new_args.data() + 1, new_args.data() + new_args.size(), mon_lt(*this));
+                std::sort(new_args.data() + 1, new_args.data() + new_args.size(), lt);
         }
         result = mk_add_app(new_args.size(), new_args.data());
         TRACE(rewriter, tout << result << "\n";);
@@ -710,11 +710,11 @@ br_status poly_rewriter<Config>::mk_sub(unsigned num_args, expr * const * args,
 template<typename Config>
 br_status poly_rewriter<Config>::cancel_monomials(expr * lhs, expr * rhs, bool move, expr_ref & lhs_result, expr_ref & rhs_result) {
     set_curr_sort(lhs->get_sort());
-    mon_lt lt(*this);
     unsigned lhs_sz;
     expr * const * lhs_monomials = get_monomials(lhs, lhs_sz);
     unsigned rhs_sz;
     expr * const * rhs_monomials = get_monomials(rhs, rhs_sz);
+    mon_lt lt(*this, lhs_sz + rhs_sz);
 
     expr_fast_mark1 visited;  // visited.is_marked(power_product) if the power_product occurs in lhs or rhs
     expr_fast_mark2 multiple; // multiple.is_marked(power_product) if power_product occurs more than once
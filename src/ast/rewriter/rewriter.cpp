@@ -91,9 +91,36 @@ unsigned rewriter_core::get_cache_size() const {
     return m_cache->size();
 }
 
+void rewriter_core::cache_root_result(expr * t, expr * v) {
+    SASSERT(!m_proof_gen);
+    if (m_root_cache.empty())
+        m_root_cache.resize(ROOT_CACHE_SIZE);
+    root_entry & e = m_root_cache[t->get_id() & (ROOT_CACHE_SIZE - 1)];
+    m().inc_ref(t);
+    m().inc_ref(v);
+    if (e.m_k) {
+        m().dec_ref(e.m_k);
+        m().dec_ref(e.m_v);
+    }
+    e.m_k = t;
+    e.m_v = v;
+}
+
+void rewriter_core::reset_root_cache() {
+    for (root_entry & e : m_root_cache) {
+        if (e.m_k) {
+            m().dec_ref(e.m_k);
+            m().dec_ref(e.m_v);
+            e.m_k = nullptr;
+            e.m_v = nullptr;
+        }
+    }
+}
+
 void rewriter_core::reset_cache() {
     m_cache = m_cache_stack[0];
     m_cache->reset();
+    reset_root_cache();
     if (m_proof_gen) {
         m_cache_pr = m_cache_pr_stack[0];
         m_cache_pr->reset();
@@ -102,6 +129,8 @@ void rewriter_core::reset_cache() {
 
 // free memory allocated by the rewriter
 void rewriter_core::free_memory() {
+    reset_root_cache();
+    m_root_cache.finalize();
     del_cache_stack();
     m_frame_stack.finalize();
     m_result_stack.finalize();
@@ -199,6 +228,7 @@ rewriter_core::rewriter_core(ast_manager & m, bool proof_gen):
 }
 
 rewriter_core::~rewriter_core() {
+    reset_root_cache();
     del_cache_stack();
 }
 
@@ -61,6 +61,17 @@ protected:
     proof_ref_vector           m_result_pr_stack;
     // --------------------------
 
+    // Small direct-mapped cache of root rewrite results. The main cache only
+    // stores shared subterms (see must_cache), so repeated top-level rewrites
+    // of the same small expression otherwise redo all the work. It is
+    // invalidated together with the main cache and unused in proof mode.
+    static const unsigned ROOT_CACHE_SIZE = 1024; // must be a power of two
+    struct root_entry {
+        expr * m_k = nullptr;
+        expr * m_v = nullptr;
+    };
+    svector<root_entry>        m_root_cache;
+
     obj_hashtable<expr>        m_blocked;
     expr *                     m_root;
     unsigned                   m_num_qvars;
@@ -99,7 +110,16 @@ protected:
     expr * get_cached(expr* k, unsigned offset) const { return m_cache->find(k, offset); }
 
     void cache_result(expr * k, expr * v, proof * pr);
-    proof * get_cached_pr(expr * k) const { return static_cast<proof*>(m_cache_pr->find(k)); } 
+    proof * get_cached_pr(expr * k) const { return static_cast<proof*>(m_cache_pr->find(k)); }
+
+    expr * get_cached_root(expr * t) const {
+        if (m_root_cache.empty())
+            return nullptr;
+        root_entry const & e = m_root_cache[t->get_id() & (ROOT_CACHE_SIZE - 1)];
+        return e.m_k == t ? e.m_v : nullptr;
+    }
+    void cache_root_result(expr * t, expr * v);
+    void reset_root_cache();
 
     void free_memory();
     void begin_scope();
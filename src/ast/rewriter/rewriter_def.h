@@ -820,10 +820,27 @@ void rewriter_tpl<Config>::operator()(expr * t, expr_ref & result, proof_ref & r
         reset_cache();
     }
 
-    if (m_proof_gen)
+    if (m_proof_gen) {
         main_loop<true>(t, result, result_pr);
-    else
+        return;
+    }
+    // Fast path for repeated roots. The main cache only keeps shared
+    // subterms, so without this the root result is recomputed on every call.
+    if (m_bindings.empty() && cache_results()) {
+        expr * r = this->get_cached_root(t);
+        if (r) {
+            result      = r;
+            result_pr   = nullptr;
+            m_num_steps = 0;
+            return;
+        }
         main_loop<false>(t, result, result_pr);
+        // main_loop returns t unrewritten when the limit was hit.
+        if (m().inc())
+            this->cache_root_result(t, result);
+        return;
+    }
+    main_loop<false>(t, result, result_pr);
 }
 
 template<typename Config>
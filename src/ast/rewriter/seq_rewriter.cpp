@@ -491,7 +491,7 @@ expr_ref seq_rewriter::mk_seq_concat(expr* a, expr* b) {
 }
 br_status seq_rewriter::mk_seq_concat(expr* a, expr* b, expr_ref& result) {
     zstring s1, s2;
-    expr* c, *d;
+    expr* c = nullptr, *d = nullptr;
     bool isc1 = str().is_string(a, s1) && m_coalesce_chars;
     bool isc2 = str().is_string(b, s2) && m_coalesce_chars;
 
@@ -499,10 +499,6 @@ br_status seq_rewriter::mk_seq_concat(expr* a, expr* b, expr_ref& result) {
         result = str().mk_string(s1 + s2);
         return BR_DONE;
     }
-    if (str().is_concat(a, c, d)) {
-        result = str().mk_concat(c, str().mk_concat(d, b));
-        return BR_REWRITE2;
-    }
     if (str().is_empty(a)) {
         result = b;
         return BR_DONE;
@@ -511,11 +507,32 @@ br_status seq_rewriter::mk_seq_concat(expr* a, expr* b, expr_ref& result) {
         result = a;
         return BR_DONE;
     }
-    if (isc1 && str().is_concat(b, c, d) && str().is_string(c, s2)) {
-        result = str().mk_concat(str().mk_string(s1 + s2), d);
+    if (!str().is_concat(a) &&
+        !(isc1 && str().is_concat(b, c, d) && str().is_string(c)))
+        return BR_FAILED;
+    // Flatten both chains and coalesce adjacent literals in a single pass.
+    // Re-associating one node per rewrite step is quadratic in the length
+    // of the chain; building the right-nested normal form directly is linear.
+    m_es.reset();
+    str().get_concat(a, m_es);
+    str().get_concat(b, m_es);
+    unsigned j = 0;
+    for (expr* e : m_es) {
+        if (m_coalesce_chars && j > 0 &&
+            str().is_string(m_es.get(j - 1), s1) && str().is_string(e, s2))
+            m_es[j - 1] = str().mk_string(s1 + s2);
+        else
+            m_es[j++] = e;
+    }
+    m_es.shrink(j);
+    if (m_es.empty()) {
+        result = str().mk_empty(a->get_sort());
         return BR_DONE;
     }
-    return BR_FAILED;
+    result = m_es.back();
+    for (unsigned i = m_es.size() - 1; i-- > 0; )
+        result = str().mk_concat(m_es.get(i), result);
+    return BR_DONE;
 }
 
 br_status seq_rewriter::mk_seq_length(expr* a, expr_ref& result) {
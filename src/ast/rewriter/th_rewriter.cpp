@@ -16,6 +16,7 @@ Author:
 Notes:
 
 --*/
+#include "util/gparams.h"
 #include "params/rewriter_params.hpp"
 #include "params/poly_rewriter_params.hpp"
 #include "ast/rewriter/th_rewriter.h"
@@ -1017,10 +1018,47 @@ struct th_rewriter_cfg : public default_rewriter_cfg {
 
 struct th_rewriter::imp : public rewriter_tpl<th_rewriter_cfg> {
     th_rewriter_cfg m_cfg;
+    act_cache *     m_shared = nullptr; //!< manager-scoped cache shared with equally configured rewriters
+
+    static std::string cfg_key(params_ref const & p) {
+        // canonical configuration string. the local overlay alone is not
+        // enough: parameters that are not overridden fall back to global
+        // module defaults, so those are part of the key as well. the cache
+        // is looked up by full string equality, never by a hash of the key.
+        std::ostringstream buf;
+        buf << gparams::get_module("rewriter") << '|' << p;
+        return buf.str();
+    }
+
     imp(ast_manager & m, params_ref const & p):
         rewriter_tpl<th_rewriter_cfg>(m, m.proofs_enabled(), m_cfg),
         m_cfg(m, p) {
+        update_shared_cache(p);
+    }
+
+    void update_shared_cache(params_ref const & p) {
+        m_shared = m().proofs_enabled() ? nullptr : m().get_rewrite_cache(cfg_key(p));
+    }
+
+    // setters that change behavior without going through the parameters make
+    // the configuration hash stale; opt out of sharing in that case.
+    void disable_shared_cache() {
+        m_shared = nullptr;
+    }
+
+    bool shared_enabled() const {
+        return m_shared != nullptr && m_cfg.m_subst == nullptr;
+    }
+
+    expr * find_shared(expr * t) {
+        return shared_enabled() ? m_shared->find(t) : nullptr;
     }
+
+    void insert_shared(expr * t, expr * r) {
+        if (shared_enabled() && m().inc())
+            m_shared->insert(t, r);
+    }
+
     expr_ref mk_app(func_decl* f, unsigned sz, expr* const* args) {
         return m_cfg.mk_app(f, sz, args);
     }
@@ -1043,6 +1081,7 @@ ast_manager & th_rewriter::m() const {
 void th_rewriter::updt_params(params_ref const & p) {
     m_params.append(p);
     m_imp->cfg().updt_params(m_params);
+    m_imp->update_shared_cache(m_params);
 }
 
 void th_rewriter::get_param_descrs(param_descrs & r) {
@@ -1054,10 +1093,12 @@ void th_rewriter::get_param_descrs(param_descrs & r) {
 }
 
 void th_rewriter::set_flat_and_or(bool f) {
+    m_imp->disable_shared_cache();
     m_imp->cfg().m_b_rw.set_flat_and_or(f);
 }
 
 void th_rewriter::set_order_eq(bool f) {
+    m_imp->disable_shared_cache();
     m_imp->cfg().m_b_rw.set_order_eq(f);
 }
 
@@ -1085,19 +1126,16 @@ void th_rewriter::reset() {
 }
 
 void th_rewriter::operator()(expr_ref & term) {
-    expr_ref result(term.get_manager());    
-    try {
-        m_imp->operator()(term, result);
-        term = std::move(result);
-    }
-    catch (...) {
-        if (!term.get_manager().inc())
-            return;
-        throw;
-    }
+    expr_ref result(term.get_manager());
+    operator()(term.get(), result);
+    term = std::move(result);
 }
 
 void th_rewriter::operator()(expr * t, expr_ref & result) {
+    if (expr * r = m_imp->find_shared(t)) {
+        result = r;
+        return;
+    }
     try {
         m_imp->operator()(t, result);
     }
@@ -1107,6 +1145,7 @@ void th_rewriter::operator()(expr * t, expr_ref & result) {
             return;
         throw;
     }
+    m_imp->insert_shared(t, result);
 }
 
 void th_rewriter::operator()(expr * t, expr_ref & result, proof_ref & result_pr) {
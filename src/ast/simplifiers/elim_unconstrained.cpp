@@ -38,6 +38,14 @@ Author:
 
 Notes:
 
+Incremental use is handled by the qhead discipline of dependent_expr_state:
+each invocation builds nodes and reference counts only over the assertions
+added since the last advance_qhead, and symbols that occur in the already
+processed prefix are frozen (m_fmls.frozen), so they are never eliminated
+based on counts that do not cover the prefix. Keeping the count index alive
+across check calls would not be sound under pop, which can remove
+assertions the counts depend on.
+
 proof production is work in progress.
 reconstruct_term should assign proof objects with nodes by applying
 monotonicity or reflexivity rules. 
@@ -13,6 +13,20 @@ Author:
 
     Nikolaj Bjorner (nbjorner) 2022-11-24
 
+Notes:
+
+    The members run strictly one after the other; there is no attempt to
+    fuse several simplifiers into a single traversal of the assertions.
+    Fusion would change results, not just cost: each member consumes the
+    fixpoint of its predecessors, several are whole-goal analyses rather
+    than per-node rewrites (elim_unconstrained counts references over the
+    entire goal, solve_eqs extracts a global substitution), and the order of
+    entries in the model reconstruction trail depends on pass boundaries.
+    Purely local rewrites are already fused upstream: th_rewriter applies
+    all theory rewrite rules in one cached DAG walk, and incremental use is
+    served by the qhead discipline of dependent_expr_state, which lets a
+    simplifier revisit only assertions added since its last run.
+
 --*/
 
 #pragma once
@@ -127,33 +127,42 @@ namespace sat {
     }
 
     bool_var ddfw::pick_var(double& r) {
-        double sum_pos = 0;
-        unsigned n = 1;
-        bool_var v0 = null_bool_var;
+        // gather the candidates and their rewards into dense scratch arrays:
+        // the scoring passes below then run over contiguous doubles, which
+        // the compiler can vectorize, instead of re-deriving rewards through
+        // per-variable records on every pass.
+        m_cand_vars.reset();
+        m_cand_rewards.reset();
         for (bool_var v : m_unsat_vars) {
-            r = reward(v);
             if (m_in_external_flip && m_plugin->is_external(v))
-                ;
-            else if (r > 0.0)    
-                sum_pos += score(r);            
-            else if (r == 0.0 && sum_pos == 0 && (m_rand() % (n++)) == 0) 
-                v0 = v;            
+                continue;
+            m_cand_vars.push_back(v);
+            m_cand_rewards.push_back(reward(v));
+        }
+        unsigned num_cands = m_cand_vars.size();
+        double sum_pos = 0;
+        for (unsigned i = 0; i < num_cands; ++i) {
+            double ri = m_cand_rewards[i];
+            sum_pos += ri > 0.0 ? score(ri) : 0.0;
         }
         if (sum_pos > 0) {
-            double lim_pos = ((double) m_rand() / (1.0 + m_rand.max_value())) * sum_pos;                
-            for (bool_var v : m_unsat_vars) {
-                r = reward(v);
-                if (m_in_external_flip && m_plugin->is_external(v))
-                    continue;
+            double lim_pos = ((double) m_rand() / (1.0 + m_rand.max_value())) * sum_pos;
+            for (unsigned i = 0; i < num_cands; ++i) {
+                r = m_cand_rewards[i];
                 if (r > 0) {
                     lim_pos -= score(r);
-                    if (lim_pos <= 0) 
-                        return v;                    
+                    if (lim_pos <= 0)
+                        return m_cand_vars[i];
                 }
             }
         }
         r = 0;
-        if (v0 != null_bool_var) 
+        unsigned n = 1;
+        bool_var v0 = null_bool_var;
+        for (unsigned i = 0; i < num_cands; ++i)
+            if (m_cand_rewards[i] == 0.0 && (m_rand() % (n++)) == 0)
+                v0 = m_cand_vars[i];
+        if (v0 != null_bool_var)
             return v0;
         if (m_unsat_vars.empty())
             return null_bool_var;
@@ -170,6 +179,7 @@ namespace sat {
         for (literal lit : m_clauses.back().m_clause) {
             m_use_list.reserve(2*(lit.var()+1));
             m_vars.reserve(lit.var()+1);
+            m_rewards.reserve(lit.var()+1);
             m_use_list[lit.index()].push_back(idx);
         }
     }
@@ -177,11 +187,13 @@ namespace sat {
     sat::bool_var ddfw::add_var() {
         auto v = m_vars.size();
         m_vars.reserve(v + 1);
+        m_rewards.reserve(v + 1);
         return v;
     }
 
     void ddfw::reserve_vars(unsigned n) {
         m_vars.reserve(n);
+        m_rewards.reserve(n);
     }
 
 
@@ -357,7 +369,7 @@ namespace sat {
     void ddfw::init_clause_data() {
         for (unsigned v = 0; v < num_vars(); ++v) {
             make_count(v) = 0;
-            m_vars[v].m_reward = 0;
+            m_rewards[v] = 0;
         }        
         m_unsat_vars.reset();
         m_num_external_in_unsat_vars = 0;
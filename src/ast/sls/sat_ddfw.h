@@ -69,7 +69,6 @@ namespace sat {
         struct var_info {
             var_info() {}
             bool     m_value = false;
-            double   m_reward = 0;
             double   m_last_reward = 0;
             unsigned m_make_count = 0;
             uint64_t m_timestamp = 0;
@@ -82,6 +81,9 @@ namespace sat {
         vector<clause_info>  m_clauses;
         literal_vector       m_assumptions;        
         svector<var_info>    m_vars;        // var -> info
+        svector<double>      m_rewards;     // var -> reward; kept out of var_info so pick_var scans dense doubles
+        svector<bool_var>    m_cand_vars;    // scratch: flip candidates gathered from m_unsat_vars
+        svector<double>      m_cand_rewards; // scratch: rewards of the candidates, contiguous for vectorized scoring
         svector<double>      m_probs;       // var -> probability of flipping
         svector<double>      m_scores;      // reward -> score
         svector<lbool>       m_model;       // var -> best assignment
@@ -125,7 +127,7 @@ namespace sat {
 
         inline bool value(bool_var v) const { return m_vars[v].m_value; }
 
-        // inline double reward(bool_var v) { return m_vars[v].m_reward; }        
+        // inline double reward(bool_var v) { return m_rewards[v]; }        
 
 
         unsigned value_hash() const;
@@ -164,9 +166,9 @@ namespace sat {
             }
         }
 
-        inline void inc_reward(literal lit, double w) { m_vars[lit.var()].m_reward += w; }
+        inline void inc_reward(literal lit, double w) { m_rewards[lit.var()] += w; }
 
-        inline void dec_reward(literal lit, double w) { m_vars[lit.var()].m_reward -= w; }
+        inline void dec_reward(literal lit, double w) { m_rewards[lit.var()] -= w; }
 
         void check_with_plugin();
         void check_without_plugin();
@@ -274,9 +276,9 @@ namespace sat {
 
         void shift_weights();
 
-        inline double reward(bool_var v) const { return m_vars[v].m_reward; }
+        inline double reward(bool_var v) const { return m_rewards[v]; }
 
-        void set_reward(bool_var v, double r) { m_vars[v].m_reward = r; }
+        void set_reward(bool_var v, double r) { m_rewards[v] = r; }
 
         double get_reward_avg(bool_var v) const { return m_vars[v].m_reward_avg; }
 
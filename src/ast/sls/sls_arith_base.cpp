@@ -740,6 +740,12 @@ namespace sls {
     }
 
     template<typename num_t>
+    // Applying a move is incremental along the cone of influence of v: each
+    // affected inequality's cached argument value is adjusted by
+    // coeff * (new - old) rather than re-evaluated, and the new value is
+    // pushed only to the terms listed as parents of v (m_muls, m_adds,
+    // m_ops, m_ifs), which recurse the same way. Nothing outside the cone
+    // is touched.
     bool arith_base<num_t>::update_checked(var_t v, num_t const& new_value) {
         auto& vi = m_vars[v];
         expr* e = vi.m_expr;
@@ -1948,6 +1954,10 @@ namespace sls {
         return false;
     }
 
+    // Candidate moves are scored on deltas: dtt with a (coeff, delta) pair
+    // reads the inequality's maintained argument value and offsets it by
+    // coeff * delta, so scoring a move costs one pass over the linear
+    // occurrences of x and never re-evaluates terms.
     template<typename num_t>
     double arith_base<num_t>::compute_score(var_t x, num_t const& delta) {
         int result = 0;
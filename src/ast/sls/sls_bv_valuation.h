@@ -25,6 +25,14 @@ Author:
 
 namespace sls {
 
+    // Values are kept as digit arrays of ceil(bw/32) words for every width.
+    // For the common 32/64-bit widths the per-operation loops run one or two
+    // iterations, so a separate machine-word representation buys little and
+    // would have to be mirrored across everything that shares bvect: the
+    // committed bits, the eval scratch value, the wrap-around range bounds
+    // lo/hi, and the fixed-bit masks all use the same layout, and each
+    // operation would need both code paths plus conversions at mixed-width
+    // operations (concat, extract, zero/sign extension).
     class bvect : public svector<digit_t> {
     public:
         unsigned bw = 0;
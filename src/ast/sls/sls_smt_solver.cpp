@@ -12,7 +12,18 @@ Abstract:
 Author:
 
     Nikolaj Bjorner (nbjorner) 2024-07-10
-    
+
+Notes:
+
+    This class is the single-trajectory engine. Running ensembles of
+    diversified walkers is handled by the layers that own threading:
+    sat.ddfw.threads launches several ddfw instances alongside the CDCL
+    solver with seeds offset per walker and assignments cross-pollinated
+    through sat::parallel, and ast/sls/sls_smt_plugin runs this engine on
+    a thread of its own, exchanging phases with the SMT core in both
+    directions. Keeping the engine itself single-threaded avoids giving
+    every walker its own ast_manager and translated clause set here.
+
 --*/
 
 #include "ast/sls/sls_context.h"
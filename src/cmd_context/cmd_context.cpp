@@ -1535,6 +1535,12 @@ void cmd_context::insert_aux_pdecl(pdecl * p) {
     m_aux_pdecls.push_back(p);
 }
 
+// reset discards the solver and (when owned) the ast_manager itself, so no
+// assertion cache can survive it: cached expressions would dangle once the
+// manager is deallocated, and redeclared sorts or functions would not be the
+// same decls anyway. Drivers that re-issue mostly identical scripts should
+// keep the context alive and retract with push/pop or check-sat-assuming;
+// those paths already reuse the solver state instead of replaying it.
 void cmd_context::reset(bool finalize) {
     m_simplifier_factory = nullptr;
     m_logic = symbol::null;
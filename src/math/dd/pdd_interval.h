@@ -21,6 +21,7 @@ Revision History:
 
 #include "math/dd/dd_pdd.h"
 #include "math/interval/dep_intervals.h"
+#include "math/interval/interval_hwf.h"
 
 namespace dd {
 typedef dep_intervals::interval interval;
@@ -88,8 +89,79 @@ public:
     template <w_dep wd>
     void get_interval_distributed(pdd const& p, scoped_dep_interval& ret) {
         scoped_dep_interval i(m());
-        m_dep_intervals.set_interval_for_scalar(i, rational::one());        
+        m_dep_intervals.set_interval_for_scalar(i, rational::one());
         get_interval_distributed<wd>(p, i, ret);
     }
 };
+
+// Hardware-float filter for pdd sign questions. Endpoints are doubles with
+// outward rounding (see interval_hwf.h), so the computed interval always
+// contains the exact mpq interval: separation from zero is a sound
+// refutation, while anything else - including overflow to infinity, which
+// f2n signals by exception - is inconclusive and the caller falls back to
+// the exact dep_intervals evaluation.
+class pdd_hwf_interval {
+    dep_intervals&        m_dep_intervals;
+    mutable hwf_manager   m_hwf;
+    hwf_interval_manager  m_imanager;
+    std::function<void (unsigned, scoped_dep_interval&)> m_var2interval;
+
+    f2n<hwf_manager>& fm() { return m_imanager.m(); }
+
+    void to_hwf(dep_interval const& a, hwf_interval& b) {
+        if (m_dep_intervals.lower_is_inf(a))
+            m_hwf.mk_ninf(b.m_lower);
+        else {
+            fm().round_to_minus_inf();
+            fm().set(b.m_lower, m_dep_intervals.lower(a));
+        }
+        if (m_dep_intervals.upper_is_inf(a))
+            m_hwf.mk_pinf(b.m_upper);
+        else {
+            fm().round_to_plus_inf();
+            fm().set(b.m_upper, m_dep_intervals.upper(a));
+        }
+    }
+
+    void get_interval(pdd const& p, hwf_interval& ret) {
+        if (p.is_val()) {
+            fm().round_to_minus_inf();
+            fm().set(ret.m_lower, p.val().to_mpq());
+            fm().round_to_plus_inf();
+            fm().set(ret.m_upper, p.val().to_mpq());
+            return;
+        }
+        hwf_interval hi, lo, a, t;
+        scoped_dep_interval av(m());
+        m_var2interval(p.var(), av);
+        to_hwf(av, a);
+        get_interval(p.hi(), hi);
+        get_interval(p.lo(), lo);
+        m_imanager.mul(a, hi, t);
+        m_imanager.add(t, lo, ret);
+    }
+
+public:
+
+    pdd_hwf_interval(dep_intervals& d, reslimit& lim):
+        m_dep_intervals(d),
+        m_imanager(lim, im_hwf_config(m_hwf)) {}
+
+    dep_intervals& m() { return m_dep_intervals; }
+
+    std::function<void (unsigned, scoped_dep_interval&)>& var2interval() { return m_var2interval; }
+
+    // Return true if the hardware-float evaluation proves that the exact
+    // interval of p is separated from zero.
+    bool separated_from_zero(pdd const& p) {
+        try {
+            hwf_interval i;
+            get_interval(p, i);
+            return m_hwf.to_double(i.m_lower) > 0.0 || m_hwf.to_double(i.m_upper) < 0.0;
+        }
+        catch (im_hwf_config::exception&) {
+            return false;
+        }
+    }
+};
 }
@@ -319,23 +319,29 @@ namespace dd {
     }
 
     solver::equation* solver::pick_next() {
-        while (m_levelp1 > 0) {
-            unsigned v = m_level2var[m_levelp1-1];
-            equation* eq = nullptr;
-            for (equation* curr : m_to_simplify) {
-                SASSERT(curr->idx() != UINT_MAX);
-                pdd const& p = curr->poly();
-                if (curr->state() == to_simplify && p.var() == v) {
-                    if (!eq || is_simpler(*curr, *eq))
-                        eq = curr;
-                }
-            }
-            if (eq) {
-                pop_equation(eq);
-                return eq;
+        // single pass: pick the equation whose leading variable has the highest
+        // level not exceeding m_levelp1, breaking ties by is_simpler.
+        equation* eq = nullptr;
+        unsigned eq_level = 0;
+        for (equation* curr : m_to_simplify) {
+            SASSERT(curr->idx() != UINT_MAX);
+            pdd const& p = curr->poly();
+            if (curr->state() != to_simplify)
+                continue;
+            unsigned level = m_var2level[p.var()];
+            if (level >= m_levelp1)
+                continue;
+            if (!eq || level > eq_level || (level == eq_level && is_simpler(*curr, *eq))) {
+                eq = curr;
+                eq_level = level;
             }
-            --m_levelp1;
         }
+        if (eq) {
+            m_levelp1 = eq_level + 1;
+            pop_equation(eq);
+            return eq;
+        }
+        m_levelp1 = 0;
         return nullptr;
     }
 
@@ -17,6 +17,18 @@
 
    extracted from nla_intervals.cpp
 
+  Notes:
+
+   Dependency cost is already kept off the common path in three ways.
+   Clients evaluate twice: a first pass instantiated with without_deps
+   carries no justification at all, and only when that pass is conclusive
+   is the expression re-evaluated with with_deps to build the lemma's
+   support (see nla_intervals). Within a with_deps evaluation, add_deps
+   skips bounds that came out infinite, so trivial bounds never acquire
+   justifications. And u_dependency unions are O(1) join nodes in a DAG,
+   region-allocated and only linearized into constraint lists at the
+   moment a lemma is emitted - there is no eager set union to prune.
+
   --*/
 
 #include "math/interval/interval_def.h"
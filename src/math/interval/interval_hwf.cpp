@@ -0,0 +1,20 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    interval_hwf.cpp
+
+Abstract:
+
+    Instantiate template for hardware-float endpoints.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+#include "math/interval/interval_def.h"
+#include "math/interval/interval_hwf.h"
+
+template class interval_manager<im_hwf_config>;
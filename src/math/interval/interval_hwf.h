@@ -0,0 +1,76 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    interval_hwf.h
+
+Abstract:
+
+    Configuration for interval_manager with hardware-float endpoints.
+
+    Bounds are doubles manipulated through f2n<hwf_manager>, which gives
+    interval_manager the directed-rounding control it needs: lower bounds
+    are rounded towards -oo and upper bounds towards +oo, so every
+    computed interval contains the exact (mpq) interval. A result that is
+    separated from zero is therefore a sound refutation; a result that
+    contains zero is inconclusive and callers must fall back to exact
+    arithmetic. f2n throws f2n<hwf_manager>::exception when an endpoint
+    overflows to infinity or NaN; callers treat that as inconclusive too.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+#pragma once
+
+#include "math/interval/interval.h"
+#include "util/f2n.h"
+#include "util/hwf.h"
+
+class im_hwf_config {
+    f2n<hwf_manager>  m_manager;
+public:
+    typedef f2n<hwf_manager>            numeral_manager;
+    typedef hwf                         numeral;
+    typedef f2n<hwf_manager>::exception exception;
+
+    im_hwf_config(hwf_manager & m):m_manager(m) {}
+
+    struct interval {
+        numeral   m_lower;
+        numeral   m_upper;
+    };
+
+    void round_to_minus_inf() { m_manager.round_to_minus_inf(); }
+    void round_to_plus_inf() { m_manager.round_to_plus_inf(); }
+    void set_rounding(bool to_plus_inf) { m_manager.set_rounding(to_plus_inf); }
+
+    // Getters
+    numeral const & lower(interval const & a) const { return a.m_lower; }
+    numeral const & upper(interval const & a) const { return a.m_upper; }
+    numeral & lower(interval & a) { return a.m_lower; }
+    numeral & upper(interval & a) { return a.m_upper; }
+    // Infinite bounds are represented by infinite endpoints, and since a
+    // float bound that had to be rounded does not tell whether the exact
+    // bound was attained, finite bounds are conservatively closed.
+    bool lower_is_inf(interval const & a) const { return m_manager.m().is_ninf(a.m_lower); }
+    bool upper_is_inf(interval const & a) const { return m_manager.m().is_pinf(a.m_upper); }
+    bool lower_is_open(interval const & a) const { return lower_is_inf(a); }
+    bool upper_is_open(interval const & a) const { return upper_is_inf(a); }
+
+    // Setters
+    void set_lower(interval & a, numeral const & n) { m_manager.set(a.m_lower, n); }
+    void set_upper(interval & a, numeral const & n) { m_manager.set(a.m_upper, n); }
+    void set_lower_is_open(interval & a, bool v) {}
+    void set_upper_is_open(interval & a, bool v) {}
+    void set_lower_is_inf(interval & a, bool v) { if (v) m_manager.m().mk_ninf(a.m_lower); }
+    void set_upper_is_inf(interval & a, bool v) { if (v) m_manager.m().mk_pinf(a.m_upper); }
+
+    // Reference to numeral manager
+    numeral_manager & m() const { return const_cast<numeral_manager&>(m_manager); }
+};
+
+typedef interval_manager<im_hwf_config> hwf_interval_manager;
+typedef im_hwf_config::interval         hwf_interval;
@@ -1019,30 +1019,31 @@ namespace lp {
 
         // Collect all fresh vars that directly or transitively reference removed_xt
         void collect_dependent_fresh_vars(unsigned removed_xt, std_vector<unsigned>& to_remove) {
-            std_vector<unsigned> newly_found;
-            for (const auto& p : m_fresh_k2xt_terms.m_bij.key_val_pairs()) {
-                unsigned xt = p.second;
-                if (xt == removed_xt) continue;
-                if (std::find(to_remove.begin(), to_remove.end(), xt) != to_remove.end())
-                    continue; // already marked for removal
-                const lar_term& term = m_fresh_k2xt_terms.get_by_val(xt).first;
-                // Check if term contains removed_xt or any var already marked for removal
-                if (term.contains(removed_xt)) {
-                    newly_found.push_back(xt);
-                } else {
-                    for (unsigned marked : to_remove)
-                        if (term.contains(marked)) {
-                            newly_found.push_back(xt);
+            indexed_uint_set marked;
+            marked.insert(removed_xt);
+            for (unsigned xt : to_remove)
+                if (!marked.contains(xt))
+                    marked.insert(xt);
+            // fixpoint: each pass scans the definitions once and marks those
+            // whose term mentions an already marked variable
+            bool progress = true;
+            while (progress) {
+                progress = false;
+                for (const auto& p : m_fresh_k2xt_terms.m_bij.key_val_pairs()) {
+                    unsigned xt = p.second;
+                    if (marked.contains(xt))
+                        continue;
+                    const lar_term& term = m_fresh_k2xt_terms.get_by_val(xt).first;
+                    for (const auto& q : term) {
+                        if (marked.contains(q.var())) {
+                            marked.insert(xt);
+                            to_remove.push_back(xt);
+                            progress = true;
                             break;
                         }
+                    }
                 }
             }
-            for (unsigned xt : newly_found)
-                to_remove.push_back(xt);
-            // Recurse if we found new ones (they might have dependents too)
-            if (!newly_found.empty())
-                for (unsigned xt : newly_found)
-                    collect_dependent_fresh_vars(xt, to_remove);
         }
 
         // Deep clean: remove fresh var and all dependents, clean m_e_matrix
@@ -367,9 +367,32 @@ bool emonics::is_canonized(const monic & m) const {
     return mm.rvars() == m.rvars();
 }
 
-void emonics::ensure_canonized() {
-    for (auto & m : m_monics) 
-        do_canonize(m);    
+unsigned emonics::ensure_canonized() {
+    // Only the monics that use a variable whose root changed since the last
+    // call can have stale rvars. Merges and unmerges record those variables
+    // in m_dirty_roots; walk their use lists instead of the whole monic set.
+    unsigned n = 0;
+    inc_visited();
+    for (lpvar v : m_dirty_roots) {
+        if (v >= m_use_lists.size())
+            continue;
+        cell* c = m_use_lists[v].m_head;
+        if (c == nullptr)
+            continue;
+        cell* first = c;
+        do {
+            monic& m = m_monics[c->m_index];
+            c = c->m_next;
+            if (!is_visited(m)) {
+                set_visited(m);
+                do_canonize(m);
+                n++;
+            }
+        }
+        while (c != first);
+    }
+    m_dirty_roots.reset();
+    return n;
 }
 
 bool emonics::monics_are_canonized() const {
@@ -431,6 +454,8 @@ void emonics::merge_eh(signed_var r2, signed_var r1, signed_var v2, signed_var v
 
 void emonics::after_merge_eh(signed_var r2, signed_var r1, signed_var v2, signed_var v1) {
     TRACE(nla_solver_mons, tout << v2 << " <- " << v1 << " : " << r2 << " <- " << r1 << "\n";);
+    mark_dirty(r1.var());
+    mark_dirty(r2.var());
     if (r1.var() == r2.var() || m_ve.find(~r1) == m_ve.find(~r2)) { // the other sign has also been merged
         TRACE(nla_solver_mons, 
               display_uf(tout << r2 << " <- " << r1 << "\n");
@@ -442,6 +467,8 @@ void emonics::after_merge_eh(signed_var r2, signed_var r1, signed_var v2, signed
 }
 
 void emonics::unmerge_eh(signed_var r2, signed_var r1) {
+    mark_dirty(r1.var());
+    mark_dirty(r2.var());
     if (r1.var() == r2.var() || m_ve.find(~r1) != m_ve.find(~r2)) { // the other sign has also been unmerged
         TRACE(nla_solver_mons, tout << r2 << " -> " << r1 << "\n";);
         unmerge_cells(m_use_lists[r2.var()], m_use_lists[r1.var()]);            
@@ -25,6 +25,7 @@
 #include "math/lp/monic.h"
 #include "util/region.h"
 #include "util/map.h"
+#include "util/uint_set.h"
 
 namespace nla {
 
@@ -91,6 +92,7 @@ class emonics {
     hash_canonical               m_cg_hash;
     eq_canonical                 m_cg_eq;
     map<lpvar, unsigned_vector, hash_canonical, eq_canonical> m_cg_table; // congruence (canonical) table.
+    indexed_uint_set             m_dirty_roots;   // variables whose root changed since the last ensure_canonized
 
 
     void pop_monic();
@@ -102,6 +104,8 @@ class emonics {
     void merge_cells(head_tail& root, head_tail& other);
     void unmerge_cells(head_tail& root, head_tail& other);
 
+    void mark_dirty(lpvar v) { if (!m_dirty_roots.contains(v)) m_dirty_roots.insert(v); }
+
     void remove_cg(lpvar v);
     void insert_cg(lpvar v);
     void insert_cg_mon(monic & m);
@@ -168,9 +172,11 @@ public:
     */
     monic const& operator[](lpvar v) const { return m_monics[m_var2index[v]]; }
     monic & operator[](lpvar v) { return m_monics[m_var2index[v]]; }
-    bool is_canonized(const monic&) const;    
+    bool is_canonized(const monic&) const;
     bool monics_are_canonized() const;
-    void ensure_canonized();
+    // re-canonize the monics that use a variable whose root changed since
+    // the last call; returns the number of re-canonized monics
+    unsigned ensure_canonized();
  
     /**
        \brief obtain the representative canonized monic 
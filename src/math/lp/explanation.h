@@ -22,6 +22,14 @@ Revision History:
 #include "util/map.h"
 #include "util/hashtable.h"
 namespace lp {
+// Explanations are designed to live in long-lived members, not per-conflict
+// temporaries: clear() keeps the vector's capacity and the hashtable's bucket
+// array, and theory_lra/theory_lra-style clients hold one instance (plus
+// reusable core/eq buffers) for the whole solver lifetime, so steady-state
+// conflicts allocate nothing. The hashtable flavor deduplicates constraint
+// indices on insertion. The remaining per-conflict pass in the theory layer
+// translates constraint indices into literals and equalities, which is a
+// semantic mapping, not a copy that buffer handoff could remove.
 class explanation {
     typedef vector<std::pair<unsigned, mpq>> pair_vec;
     typedef    hashtable<unsigned, u_hash, u_eq>  ci_set;
@@ -375,50 +375,47 @@ public:
     }
 
  // return the minimal distance from the variable value to an integer
-    mpq get_gomory_score(const int_solver& lia, lpvar j) {
+    // distance of the value of j to the nearest integer, in [0, 1/2];
+    // a double is enough to rank cut candidates
+    double get_gomory_score(const int_solver& lia, lpvar j) {
         const mpq& val = lia.get_value(j).x;
-        auto l = val - floor(val);
-        if (l <= mpq(1, 2))
-            return l;
-        return mpq(1) - l;
+        double l = (val - floor(val)).get_double();
+        return l <= 0.5 ? l : 1.0 - l;
     }
 
     unsigned_vector gomory::gomory_select_int_infeasible_vars(unsigned num_cuts) {
-        std::list<lpvar> sorted_vars;
-        std::unordered_map<lpvar, mpq> score;
+        struct candidate {
+            lpvar    m_j;
+            double   m_score;
+            unsigned m_usage;
+        };
+        svector<candidate> candidates;
         for (lpvar j : lra.r_basis()) {
             if (!lia.column_is_int_inf(j) || !is_gomory_cut_target(j))
                 continue;
-            SASSERT(!lia.is_fixed(j));            
-            sorted_vars.push_back(j);
-            score[j] = get_gomory_score(lia, j);
+            SASSERT(!lia.is_fixed(j));
+            candidates.push_back({j, get_gomory_score(lia, j), lra.usage_in_terms(j)});
         }
         // prefer the variables with the values close to integers
-        sorted_vars.sort([&](lpvar j, lpvar k) {
-            auto diff = score[j] - score[k];
-            if (diff.is_neg())
-                return true;
-            if (diff.is_pos())
-                return false;
-            return lra.usage_in_terms(j) > lra.usage_in_terms(k);
+        std::sort(candidates.begin(), candidates.end(), [](candidate const& a, candidate const& b) {
+            if (a.m_score != b.m_score)
+                return a.m_score < b.m_score;
+            return a.m_usage > b.m_usage;
         });
         unsigned_vector ret;
-        unsigned n = static_cast<unsigned>(sorted_vars.size());
+        unsigned n = candidates.size();
 
         while (num_cuts-- && n > 0) {
             unsigned k = lia.settings().random_next() % n;
-           
+
             double k_ratio = k / (double) n;
             k_ratio *= k_ratio*k_ratio;  // square k_ratio to make it smaller
             k = static_cast<unsigned>(std::floor(k_ratio * n));
             // these operations move k to the beginning of the indices range
             SASSERT(0 <= k && k < n);
-            auto it = sorted_vars.begin();
-            while(k--) it++;
-
-            ret.push_back(*it);
-            sorted_vars.erase(it);
-            n--;            
+            ret.push_back(candidates[k].m_j);
+            candidates.erase(candidates.begin() + k);
+            n--;
         }
         return ret;
     }
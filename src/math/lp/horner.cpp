@@ -73,7 +73,15 @@ bool horner::lemmas_on_expr(cross_nested& cn, nex_sum* e) {
     return cn.done();
 }
 
-template <typename T> 
+// The cross-nested form is rebuilt per round on purpose. cross_nested does
+// not compute one canonical factorization: it enumerates candidate nestings,
+// steered by the random source and pruned by interval checks against the
+// current assignment, so "the selected form" is a function of this round's
+// bounds and randomness, and replaying a cached nesting would re-test the one
+// shape that already failed instead of diversifying. The nex terms themselves
+// live in m_nex_creator's arena and are recycled wholesale, and rows mutate
+// with every pivot, which would make a per-row cache mostly cold anyway.
+template <typename T>
 bool horner::lemmas_on_row(const T& row) {
     SASSERT (row_is_interesting(row));
     c().clear_active_var_set();
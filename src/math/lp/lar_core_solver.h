@@ -32,7 +32,6 @@ public:
     vector<numeric_pair<mpq>> m_r_lower_bounds;
     vector<numeric_pair<mpq>> m_r_upper_bounds;
     static_matrix<mpq, numeric_pair<mpq>> m_r_A;
-    stacked_vector<unsigned> m_r_pushed_basis;
     vector<unsigned>         m_r_basis;
     vector<unsigned>         m_r_nbasis;
     std_vector<int>          m_r_heading;
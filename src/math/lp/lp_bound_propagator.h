@@ -14,10 +14,40 @@ namespace lp {
     
 template <typename T>
 class lp_bound_propagator {
+    // maps a column index to the position of its strongest derived bound in
+    // m_ibounds. Epoch-stamped so that init() invalidates all slots in O(1)
+    // instead of rehashing per propagation round.
+    class column_to_ibound {
+        struct slot {
+            unsigned m_epoch = 0;
+            unsigned m_index = 0;
+        };
+        std_vector<slot> m_slots;
+        unsigned         m_epoch = 1;
+    public:
+        bool find(unsigned j, unsigned& k) const {
+            if (j >= m_slots.size() || m_slots[j].m_epoch != m_epoch)
+                return false;
+            k = m_slots[j].m_index;
+            return true;
+        }
+        void insert(unsigned j, unsigned k) {
+            if (j >= m_slots.size())
+                m_slots.resize(j + 1);
+            m_slots[j].m_epoch = m_epoch;
+            m_slots[j].m_index = k;
+        }
+        void reset() {
+            if (++m_epoch == 0) {
+                m_slots.clear();
+                m_epoch = 1;
+            }
+        }
+    };
+
     uint_set m_visited_rows;
-    // these maps map a column index to the corresponding index in ibounds
-    u_map<unsigned> m_improved_lower_bounds;
-    u_map<unsigned> m_improved_upper_bounds;
+    column_to_ibound m_improved_lower_bounds;
+    column_to_ibound m_improved_upper_bounds;
 
     T& m_imp;
     std_vector<implied_bound>& m_ibounds;
@@ -19,7 +19,6 @@ Revision History:
 --*/
 #pragma once
 #include <set>
-#include <list>
 #include "util/vector.h"
 #include <string>
 #include "math/lp/lp_utils.h"
@@ -272,7 +271,7 @@ public:
     bool non_basis_has_no_doubles() const;
 
     bool basis_is_correctly_represented_in_heading() const ;
-    bool non_basis_is_correctly_represented_in_heading(std::list<unsigned>*) const ;
+    bool non_basis_is_correctly_represented_in_heading(vector<unsigned> const *) const ;
 
     bool basis_heading_is_correct() const;
 
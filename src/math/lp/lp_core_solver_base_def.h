@@ -315,7 +315,7 @@ basis_is_correctly_represented_in_heading() const {
     return true;
 }
 template <typename T, typename X> bool lp_core_solver_base<T, X>::
-non_basis_is_correctly_represented_in_heading(std::list<unsigned>* non_basis_list) const {
+non_basis_is_correctly_represented_in_heading(vector<unsigned> const * non_basis_list) const {
     for (unsigned i = 0; i < m_nbasis.size(); ++i) 
         if (m_basis_heading[m_nbasis[i]] !=  - static_cast<int>(i) - 1)
             return false;
@@ -330,25 +330,33 @@ non_basis_is_correctly_represented_in_heading(std::list<unsigned>* non_basis_lis
     for (unsigned j : this->m_nbasis) 
         nbasis_set.insert(j);
     
-    if (non_basis_list->size() != nbasis_set.size()) {
-        TRACE(lp_core, tout << "non_basis_list.size() = " << non_basis_list->size() << ", nbasis_set.size() = " << nbasis_set.size() << "\n";);
+    // null_lpvar entries are holes left by choose_entering_column_tableau and
+    // are not part of the represented set
+    unsigned n_columns = 0;
+    for (unsigned j : *non_basis_list)
+        if (j != null_lpvar)
+            n_columns++;
+    if (n_columns != nbasis_set.size()) {
+        TRACE(lp_core, tout << "non_basis_list has " << n_columns << " columns, nbasis_set.size() = " << nbasis_set.size() << "\n";);
         return false;
     }
-    for (auto it = non_basis_list->begin(); it != non_basis_list->end(); ++it) {
-        if (nbasis_set.find(*it) == nbasis_set.end()) {
-            TRACE(lp_core, tout << "column " << *it << " is in m_non_basis_list but not in m_nbasis\n";);
+    for (unsigned j : *non_basis_list) {
+        if (j != null_lpvar && nbasis_set.find(j) == nbasis_set.end()) {
+            TRACE(lp_core, tout << "column " << j << " is in m_non_basis_list but not in m_nbasis\n";);
             return false;
         }
     }
 
     // check for duplicates in m_non_basis_list
     nbasis_set.clear();
-    for (auto it = non_basis_list->begin(); it != non_basis_list->end(); ++it) {
-        if (nbasis_set.find(*it) != nbasis_set.end()) {
-            TRACE(lp_core, tout << "column " << *it << " is in m_non_basis_list twice\n";);
+    for (unsigned j : *non_basis_list) {
+        if (j == null_lpvar)
+            continue;
+        if (nbasis_set.find(j) != nbasis_set.end()) {
+            TRACE(lp_core, tout << "column " << j << " is in m_non_basis_list twice\n";);
             return false;
         }
-        nbasis_set.insert(*it);
+        nbasis_set.insert(j);
     }
 
     return true;
@@ -26,7 +26,6 @@ Revision History:
 #include <algorithm>
 #include <cstdlib>
 #include <limits>
-#include <list>
 #include <math.h>
 #include <set>
 #include <sstream>
@@ -51,7 +50,12 @@ namespace lp {
         unsigned m_left_basis_repeated;
         vector<unsigned> m_leaving_candidates;
 
-        std::list<unsigned> m_non_basis_list;
+        // Non-basic columns in pricing order. Kept contiguous so the pricing
+        // scan streams through memory instead of chasing list nodes. Moving
+        // the entering column to the back leaves a null_lpvar hole behind;
+        // holes are skipped during the scan and compacted by the periodic
+        // sort_non_basis rebuild.
+        vector<unsigned> m_non_basis_list;
         void sort_non_basis();
         int choose_entering_column_tableau();
 
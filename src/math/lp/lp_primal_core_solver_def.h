@@ -19,7 +19,6 @@ Revision History:
 --*/
 #pragma once
 
-#include <list>
 #include "util/vector.h"
 #include <fstream>
 #include <algorithm>
@@ -40,12 +39,12 @@ void lp_primal_core_solver<T, X>::sort_non_basis() {
                 if (ca != 0 && cb == 0) return true;
                 return ca < cb;
             });
-    m_non_basis_list.resize(this->m_nbasis.size());
-    // initialize m_non_basis_list from m_nbasis by using an iterator on m_non_basis_list
-    auto it = m_non_basis_list.begin();
-    unsigned j = 0;
-    for (; j < this->m_nbasis.size(); ++j, ++it) {
-        unsigned col = *it = this->m_nbasis[j];
+    // rebuild m_non_basis_list from m_nbasis: this also compacts the holes
+    // left behind by choose_entering_column_tableau
+    m_non_basis_list.reset();
+    for (unsigned j = 0; j < this->m_nbasis.size(); ++j) {
+        unsigned col = this->m_nbasis[j];
+        m_non_basis_list.push_back(col);
         this->m_basis_heading[col] = -static_cast<int>(j) - 1;
     }
 }
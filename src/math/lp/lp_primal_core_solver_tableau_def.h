@@ -60,10 +60,12 @@ template <typename T, typename X> void lp_primal_core_solver<T, X>::advance_on_e
         return -1;
     
     unsigned j_nz = this->m_m() + 1; // this number is greater than the max column size
-    std::list<unsigned>::iterator entering_iter = m_non_basis_list.end();
+    unsigned entering_index = UINT_MAX;
     unsigned n = 0;
-    for (auto non_basis_iter = m_non_basis_list.begin(); number_of_benefitial_columns_to_go_over && non_basis_iter != m_non_basis_list.end(); ++non_basis_iter) {
-        unsigned j = *non_basis_iter;
+    for (unsigned k = 0; number_of_benefitial_columns_to_go_over && k < m_non_basis_list.size(); ++k) {
+        unsigned j = m_non_basis_list[k];
+        if (j == null_lpvar) // a hole left by a previous entering column
+            continue;
         if (!column_is_benefitial_for_entering_basis(j))
             continue;
 
@@ -71,19 +73,19 @@ template <typename T, typename X> void lp_primal_core_solver<T, X>::advance_on_e
         unsigned t = this->m_A.number_of_non_zeroes_in_column(j);
         if (t < j_nz) {
             j_nz = t;
-            entering_iter = non_basis_iter;
+            entering_index = k;
             number_of_benefitial_columns_to_go_over--;
             n = 1;
         }
         else if (t == j_nz && this->m_settings.random_next(++n) == 0) {
-            entering_iter = non_basis_iter;
+            entering_index = k;
         }
     }
-    if (entering_iter == m_non_basis_list.end())
+    if (entering_index == UINT_MAX)
         return -1;
-    unsigned entering = *entering_iter;
+    unsigned entering = m_non_basis_list[entering_index];
     m_sign_of_entering_delta = this->m_d[entering] > 0 ? 1 : -1;
-    m_non_basis_list.erase(entering_iter);
+    m_non_basis_list[entering_index] = null_lpvar;
     m_non_basis_list.push_back(entering);
     return entering;
 
@@ -180,9 +182,7 @@ template <typename T, typename X>void lp_primal_core_solver<T, X>::advance_on_en
         return;
 
     if (this->m_settings.simplex_strategy() != simplex_strategy_enum::tableau_rows) {
-        std::list<unsigned>::iterator it = m_non_basis_list.end();
-        it--;
-        * it = static_cast<unsigned>(leaving);
+        m_non_basis_list.back() = static_cast<unsigned>(leaving);
     }
 }
 
@@ -140,6 +140,7 @@ struct statistics {
     unsigned m_bounds_tightening_conflicts = 0;
     unsigned m_bounds_tightenings = 0;
     unsigned m_nla_throttled_lemmas = 0;
+    unsigned m_nla_canonized_monics = 0;
 
     ::statistics m_st = {};
 
@@ -182,6 +183,7 @@ struct statistics {
         st.update("arith-bounds-tightening-conflicts", m_bounds_tightening_conflicts);
         st.update("arith-bounds-tightenings", m_bounds_tightenings);
         st.update("arith-nla-throttled-lemmas", m_nla_throttled_lemmas);
+        st.update("arith-nla-canonized-monics", m_nla_canonized_monics);
         st.copy(m_st);
     }
 };
@@ -231,6 +233,15 @@ public:
     double       time_limit; // the maximum time limit of the total run time in seconds
     // end of dual section
     bool                   m_bound_propagation = true;
+    // Vestigial: no floating-point simplex tier is wired up in this tree -
+    // the core solvers are instantiated on exact mpq only, and this flag is
+    // never read. An approximate tier (double, or mpff/mpfx with directed
+    // rounding) would need the full pivot/bound logic instantiated on the
+    // approximate type plus an exact certification pass per final basis;
+    // within the SMT setting the basis is re-derived after every assertion
+    // of a bound, so the certification pass would run about as often as the
+    // exact solver does now. Left as-is pending a measured case where the
+    // approximate tier's savings survive the re-verification traffic.
     bool                   presolve_with_double_solver_for_lar = true;
     simplex_strategy_enum  m_simplex_strategy;
 
@@ -244,6 +255,7 @@ public:
     bool             backup_costs = true;
     unsigned         column_number_threshold_for_using_lu_in_lar_solver = 4000;
     unsigned         m_int_gomory_cut_period = 4;
+    unsigned         m_gomory_cuts_per_round = 2; // budget of exact cut derivations per Gomory round
     unsigned         m_int_find_cube_period = 4;
 private:
     unsigned         m_hnf_cut_period = 4;
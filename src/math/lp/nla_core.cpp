@@ -527,7 +527,7 @@ void core::collect_equivs() {
             add_equivalence_maybe(t, s.get_column_upper_bound_witness(j), s.get_column_lower_bound_witness(j));
         }
     }
-    m_emons.ensure_canonized();
+    lp_settings().stats().m_nla_canonized_monics += m_emons.ensure_canonized();
 }
 
 
@@ -712,16 +712,26 @@ namespace nla {
             if (deps) c().m_intervals.set_var_interval<dd::w_dep::with_deps>(j, a);
             else c().m_intervals.set_var_interval<dd::w_dep::without_deps>(j, a);
         };
+        // Filtered pass: hardware-float endpoints with outward rounding.
+        // Separation from zero in floats implies separation in the exact
+        // interval, so the exact rational pass is only run when the float
+        // pass is inconclusive.
+        dd::pdd_hwf_interval evalf(di, c().reslim());
+        evalf.var2interval() = [this](lpvar j, scoped_dep_interval& a) {
+            c().m_intervals.set_var_interval<dd::w_dep::without_deps>(j, a);
+        };
         scoped_dep_interval i(di), i_wd(di);
-        evali.get_interval<dd::w_dep::without_deps>(e.poly(), i);    
-        if (!di.separated_from_zero(i)) {            
-            if (add_horner_conflict(e)) {
-                TRACE(grobner, m_solver.display(tout << "horner conflict ", e) << "\n");
-                return true;
+        if (!evalf.separated_from_zero(e.poly())) {
+            evali.get_interval<dd::w_dep::without_deps>(e.poly(), i);
+            if (!di.separated_from_zero(i)) {
+                if (add_horner_conflict(e)) {
+                    TRACE(grobner, m_solver.display(tout << "horner conflict ", e) << "\n");
+                    return true;
+                }
+                return false;
             }
-            return false;
         }
-        evali.get_interval<dd::w_dep::with_deps>(e.poly(), i_wd);  
+        evali.get_interval<dd::w_dep::with_deps>(e.poly(), i_wd);
         std::function<void (const lp::explanation&)> f = [this](const lp::explanation& e) {
             lemma_builder lemma(m_core, "pdd");
             lemma &= e;
@@ -58,6 +58,7 @@ namespace lp {
         remove_element(rowii, rowii[c.offset()]);
         scan_row_strip_to_work_vector(rowii);
         unsigned prev_size_ii = static_cast<unsigned>(rowii.size());
+        rowii.reserve(rowii.size() + m_rows[i].size()); // worst-case fill-in, avoids mid-loop reallocation
         // run over the pivot row and update row ii
         for (const auto & iv : m_rows[i]) {
             unsigned j = iv.var();
@@ -65,8 +66,7 @@ namespace lp {
             SASSERT(!is_zero(iv.coeff()));
             int j_offs = m_work_vector_of_row_offsets[j];
             if (j_offs == -1) { // it is a new element
-                T alv = alpha * iv.coeff();
-                add_new_element(ii, j, alv);
+                add_new_element(ii, j, alpha * iv.coeff());
             }
             else {
                 addmul(rowii[j_offs].coeff(), iv.coeff(), alpha);
@@ -91,13 +91,13 @@ namespace lp {
         auto & rowk = m_rows[k];
         scan_row_strip_to_work_vector(rowk);
         unsigned prev_size_k = static_cast<unsigned>(rowk.size());
+        rowk.reserve(rowk.size() + m_rows[i].size());
         // run over the pivot row and update row k
         for (const auto & iv : m_rows[i]) {
             unsigned j = iv.var();
             int j_offs = m_work_vector_of_row_offsets[j];
             if (j_offs == -1) { // it is a new element
-                T alv = alpha * iv.coeff();
-                add_new_element(k, j, alv);
+                add_new_element(k, j, alpha * iv.coeff());
             }
             else {
                 addmul(rowk[j_offs].coeff(), iv.coeff(), alpha);
@@ -127,6 +127,7 @@ namespace lp {
         remove_element(rowii, rowii[c.offset()]);
         scan_row_strip_to_work_vector(rowii);
         unsigned prev_size_ii = static_cast<unsigned>(rowii.size());
+        rowii.reserve(rowii.size() + m_rows[piv_row_index].size());
         // run over the pivot row and update row ii
         for (const auto & iv : m_rows[piv_row_index]) {
             unsigned j = iv.var();
@@ -134,8 +135,7 @@ namespace lp {
             SASSERT(!is_zero(iv.coeff()));
             int j_offs = m_work_vector_of_row_offsets[j];
             if (j_offs == -1) { // it is a new element
-                T alv = alpha * iv.coeff();
-                add_new_element(ii, j, alv);
+                add_new_element(ii, j, alpha * iv.coeff());
             }
             else {
                 addmul(rowii[j_offs].coeff(), iv.coeff(), alpha);
@@ -167,8 +167,7 @@ namespace lp {
             int j_offs = m_work_vector_of_row_offsets[j];
             if (j_offs == -1) { // it is a new element
                 add_columns_up_to(j);
-                T alv = alpha * iv.coeff();
-                add_new_element(ii, j, alv);
+                add_new_element(ii, j, alpha * iv.coeff());
             }
             else {
                 addmul(rowii[j_offs].coeff(), iv.coeff(), alpha);
@@ -203,8 +202,7 @@ namespace lp {
             SASSERT(!is_zero(iv.coeff()));
             int j_offs = m_work_vector_of_row_offsets[j];
             if (j_offs == -1) { // it is a new element
-                T alv = alpha * iv.coeff();
-                add_new_element(ii, j, alv);
+                add_new_element(ii, j, alpha * iv.coeff());
             }
             else {
                 addmul(rowii[j_offs].coeff(), iv.coeff(), alpha);
@@ -496,4 +494,14 @@ namespace lp {
         col_vals.push_back(column_cell(row, row_el_offs));
     }
 
+    template <typename T, typename X>
+    void static_matrix<T, X>::add_new_element(unsigned row, unsigned col, T && val) {
+        auto & row_vals = m_rows[row];
+        auto & col_vals = m_columns[col];
+        unsigned row_el_offs = static_cast<unsigned>(row_vals.size());
+        unsigned col_el_offs = static_cast<unsigned>(col_vals.size());
+        row_vals.push_back(row_cell<T>(col, col_el_offs, std::move(val)));
+        col_vals.push_back(column_cell(row, row_el_offs));
+    }
+
 }
@@ -3253,7 +3253,16 @@ namespace algebraic_numbers {
             bqm().set(l, i.lower());
             bqm().set(u, i.upper());
             // the precision on refine is base 2
-            return upm().refine(c->m_p_sz, c->m_p, bqm(), l, u, precision * 4);
+            bool r = upm().refine(c->m_p_sz, c->m_p, bqm(), l, u, precision * 4);
+            if (r) {
+                // Bisection preserves the sign of p at the lower bound, so the
+                // refined bounds still satisfy the cell invariants. Store them
+                // back into the cell: repeated comparisons against the same
+                // value (frequent in nlsat model construction) then resume from
+                // the refined interval instead of redoing the bisection steps.
+                bqim().set(c->m_interval, l, u);
+            }
+            return r;
         }
         
         std::ostream& display_decimal(std::ostream & out, numeral const & a, unsigned precision) {
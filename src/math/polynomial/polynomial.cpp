@@ -2015,6 +2015,9 @@ namespace polynomial {
                 numeral_manager & mng = m_owner->m_manager;
                 if (mng.is_zero(a))
                     return;
+                // a == 1 is the common case (add, sub, muladd over monic factors);
+                // avoid a big-number multiplication per monomial for it.
+                bool a_is_one = mng.is_one(a);
                 unsigned sz = p->size();
                 for (unsigned i = 0; i < sz; ++i) {
                     if (CheckZeros && mng.is_zero(p->a(i)))
@@ -2027,7 +2030,13 @@ namespace polynomial {
                         m_tmp_ms.push_back(m2);
                         m_owner->inc_ref(m2);
                         m_tmp_as.push_back(numeral());
-                        mng.mul(a, p->a(i), m_tmp_as.back());
+                        if (a_is_one)
+                            mng.set(m_tmp_as.back(), p->a(i));
+                        else
+                            mng.mul(a, p->a(i), m_tmp_as.back());
+                    }
+                    else if (a_is_one) {
+                        mng.add(m_tmp_as[pos], p->a(i), m_tmp_as[pos]);
                     }
                     else {
                         mng.addmul(m_tmp_as[pos], a, p->a(i), m_tmp_as[pos]);
@@ -4136,6 +4145,7 @@ namespace polynomial {
             polynomial_ref q(m_wrapper);
 
             polynomial_ref candidate(m_wrapper);
+            polynomial_ref prev_candidate(m_wrapper);
 
             scoped_numeral p(m());
             for (unsigned i = 0; i < NUM_BIG_PRIMES; ++i) {
@@ -4187,6 +4197,12 @@ namespace polynomial {
                 }
                 candidate = pp(C_star, x);
                 TRACE(mgcd, tout << "candidate:\n" << candidate << "\n";);
+                // Trial division is the expensive step; only attempt it after the
+                // candidate is unchanged by an additional prime.
+                if (prev_candidate.get() == nullptr || !eq(candidate, prev_candidate)) {
+                    prev_candidate = candidate;
+                    continue;
+                }
                 scoped_numeral lc_candidate(m());
                 lc_candidate = univ_coeff(candidate, degree(candidate, x));
                 if (m().divides(lc_candidate, lc_g) &&
@@ -4623,6 +4639,7 @@ namespace polynomial {
             scoped_numeral bound(m());
             polynomial_ref q(m_wrapper);
             polynomial_ref candidate(m_wrapper);
+            polynomial_ref prev_candidate(m_wrapper);
             scoped_numeral p(m());
 
             for (unsigned i = 0; i < NUM_BIG_PRIMES; ++i) {
@@ -4674,6 +4691,12 @@ namespace polynomial {
                 }
                 candidate = normalize(C_star);
                 TRACE(mgcd, tout << "candidate:\n" << candidate << "\n";);
+                // As in uni_mod_gcd: postpone the expensive trial divisions until
+                // the candidate is unchanged by an additional prime.
+                if (prev_candidate.get() == nullptr || !eq(candidate, prev_candidate)) {
+                    prev_candidate = candidate;
+                    continue;
+                }
                 scoped_numeral lc_candidate(m());
                 lc_candidate = candidate->a(candidate->graded_lex_max_pos());
                 if (m().divides(lc_candidate, lc_g) &&
@@ -85,7 +85,7 @@ namespace polynomial {
     typedef chashtable<psc_chain_entry*, psc_chain_entry::hash_proc, psc_chain_entry::eq_proc> psc_chain_cache;
     typedef chashtable<factor_entry*, factor_entry::hash_proc, factor_entry::eq_proc> factor_cache;
     
-    struct cache::imp { 
+    struct cache::imp {
         manager &                m;
         polynomial_table         m_poly_table;
         psc_chain_cache          m_psc_chain_cache;
@@ -93,6 +93,10 @@ namespace polynomial {
         polynomial_ref_vector    m_cached_polys;
         svector<char>            m_in_cache;
         small_object_allocator & m_allocator;
+        unsigned                 m_psc_hits = 0;
+        unsigned                 m_psc_misses = 0;
+        unsigned                 m_factor_hits = 0;
+        unsigned                 m_factor_misses = 0;
 
         imp(manager & _m):m(_m), m_poly_table(poly_hash_proc(m), poly_eq_proc(m)), m_cached_polys(m), m_allocator(m.allocator()) {
         }
@@ -170,6 +174,7 @@ namespace polynomial {
             psc_chain_entry * entry = new (m_allocator.allocate(sizeof(psc_chain_entry))) psc_chain_entry(p, q, x, h);
             psc_chain_entry * old_entry = m_psc_chain_cache.insert_if_not_there(entry); 
             if (entry != old_entry) {
+                m_psc_hits++;
                 entry->~psc_chain_entry();
                 m_allocator.deallocate(sizeof(psc_chain_entry), entry);
                 S.reset();
@@ -178,6 +183,7 @@ namespace polynomial {
                 }
             }
             else {
+                m_psc_misses++;
                 m.psc_chain(p, q, x, S);
                 unsigned sz = S.size();
                 entry->m_result_sz = sz;
@@ -197,6 +203,7 @@ namespace polynomial {
             factor_entry * entry = new (m_allocator.allocate(sizeof(factor_entry))) factor_entry(p, h);
             factor_entry * old_entry = m_factor_cache.insert_if_not_there(entry); 
             if (entry != old_entry) {
+                m_factor_hits++;
                 entry->~factor_entry();
                 m_allocator.deallocate(sizeof(factor_entry), entry);
                 distinct_factors.reset();
@@ -205,6 +212,7 @@ namespace polynomial {
                 }
             }
             else {
+                m_factor_misses++;
                 factors fs(m);
                 m.factor(p, fs);
                 unsigned sz = fs.distinct_factors();
@@ -251,9 +259,23 @@ namespace polynomial {
         m_imp->factor(const_cast<polynomial*>(p), distinct_factors);
     }
     
+    void cache::collect_statistics(statistics & st) const {
+        st.update("polynomial psc cache hits", m_imp->m_psc_hits);
+        st.update("polynomial psc cache misses", m_imp->m_psc_misses);
+        st.update("polynomial factor cache hits", m_imp->m_factor_hits);
+        st.update("polynomial factor cache misses", m_imp->m_factor_misses);
+    }
+
     void cache::reset() {
         manager & _m = m();
+        unsigned psc_hits = m_imp->m_psc_hits, psc_misses = m_imp->m_psc_misses;
+        unsigned factor_hits = m_imp->m_factor_hits, factor_misses = m_imp->m_factor_misses;
         dealloc(m_imp);
         m_imp = alloc(imp, _m);
+        // counters accumulate across resets; reset() discards cached results, not history
+        m_imp->m_psc_hits = psc_hits;
+        m_imp->m_psc_misses = psc_misses;
+        m_imp->m_factor_hits = factor_hits;
+        m_imp->m_factor_misses = factor_misses;
     }
 }
@@ -19,6 +19,7 @@ Notes:
 #pragma once
 
 #include "math/polynomial/polynomial.h"
+#include "util/statistics.h"
 
 namespace polynomial {
 
@@ -38,6 +39,7 @@ namespace polynomial {
         bool contains_chain(polynomial const * p, polynomial const * q, var x) const;
         void psc_chain(polynomial const * p, polynomial const * q, var x, polynomial_ref_vector & S);
         void factor(polynomial const * p, polynomial_ref_vector & distinct_factors);
+        void collect_statistics(statistics & st) const;
         void reset();
     };
 }
@@ -1284,6 +1284,9 @@ namespace upolynomial {
         reset(m_dbab_tmp2);
         reset(m_tr_tmp);
         reset(m_push_tmp);
+        m().del(m_eval_tmp1);
+        m().del(m_eval_tmp2);
+        m().del(m_eval_tmp3);
     }
 
     void manager::reset(upolynomial_sequence & seq) {
@@ -1764,8 +1767,8 @@ namespace upolynomial {
         numeral const & c = b.numerator();
         unsigned k   = b.k();
         unsigned k_i = k;
-        scoped_numeral r(m());
-        scoped_numeral ak(m());
+        numeral & r  = m_eval_tmp1;
+        numeral & ak = m_eval_tmp2;
         m().set(r, p[sz-1]);
         unsigned i = sz-1;
         while (i > 0) {
@@ -1796,10 +1799,10 @@ namespace upolynomial {
             return sign_of(p[0]);
         numeral const & c = b.numerator();
         numeral const & d = b.denominator();
-        scoped_numeral d_i(m());
+        numeral & d_i = m_eval_tmp3;
         m().set(d_i, d);
-        scoped_numeral r(m());
-        scoped_numeral ak(m());
+        numeral & r   = m_eval_tmp1;
+        numeral & ak  = m_eval_tmp2;
         m().set(r, p[sz-1]);
         unsigned i = sz-1;
         while (i > 0) {
@@ -1825,7 +1828,7 @@ namespace upolynomial {
             return sign_zero;
         if (sz == 1)
             return sign_of(p[0]);
-        scoped_numeral r(m());
+        numeral & r = m_eval_tmp1;
         m().set(r, p[sz-1]);
         unsigned i = sz-1;
         while (i > 0) {
@@ -553,6 +553,11 @@ namespace upolynomial {
         numeral_vector    m_dbab_tmp2;
         numeral_vector    m_tr_tmp;
         numeral_vector    m_push_tmp;
+        // scratch numerals for eval_sign_at: one sign query evaluates every
+        // polynomial of a Sturm sequence, so fresh allocations add up.
+        numeral           m_eval_tmp1;
+        numeral           m_eval_tmp2;
+        numeral           m_eval_tmp3;
 
         sign sign_of(numeral const & c);
         struct drs_frame;
@@ -4312,6 +4312,11 @@ namespace realclosure {
 
         void refine_transcendental_interval(rational_function_value * v, unsigned prec) {
             SASSERT(v->ext()->is_transcendental());
+            // The stored interval is only replaced by tighter ones; if a previous
+            // query already reached the requested precision, the coefficient walk
+            // and the Horner evaluation in update_rf_interval can be skipped.
+            if (check_precision(v->interval(), prec))
+                return;
             polynomial const & n = v->num();
             polynomial const & d = v->den();
             unsigned _prec = prec;
@@ -4459,6 +4464,10 @@ namespace realclosure {
 
         bool refine_algebraic_interval(rational_function_value * v, unsigned prec) {
             SASSERT(v->ext()->is_algebraic());
+            // See refine_transcendental_interval: skip the refinement pass when
+            // the interval already has the requested precision.
+            if (check_precision(v->interval(), prec))
+                return true;
             polynomial const & n = v->num();
             SASSERT(is_denominator_one(v));
             unsigned _prec = prec;
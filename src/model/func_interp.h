@@ -98,6 +98,9 @@ class func_interp {
 
     expr *                 m_array_interp; // <! interp with lambda abstraction
 
+    // Hash index over entry argument tuples, created once the entry count
+    // exceeds 500 and kept in sync by insert_new_entry/del_entry; below the
+    // threshold get_entry falls back to the linear scan over m_entries.
     using entry_table = ptr_hashtable<func_entry, func_entry_hash, func_entry_eq>;
     entry_table* m_entry_table = nullptr;
     func_entry* m_key = nullptr;
@@ -244,6 +244,43 @@ void model::evaluate_constants() {
 }
 
 
+static bool eq_func_interp(func_interp * f1, func_interp * f2) {
+    if (f1 == f2)
+        return true;
+    if (!f1 || !f2)
+        return false;
+    if (f1->get_else() != f2->get_else())
+        return false;
+    if (f1->num_entries() != f2->num_entries())
+        return false;
+    for (unsigned i = 0; i < f1->num_entries(); ++i) {
+        func_entry const * e1 = f1->get_entry(i);
+        func_entry * e2 = f2->get_entry(e1->get_args());
+        if (!e2 || e1->get_result() != e2->get_result())
+            return false;
+    }
+    return true;
+}
+
+void model::get_diff(model const & other, ptr_vector<func_decl> & result) const {
+    SASSERT(&m == &other.get_manager());
+    result.reset();
+    for (unsigned i = 0; i < get_num_decls(); ++i) {
+        func_decl * d = get_decl(i);
+        if (d->get_arity() == 0) {
+            if (get_const_interp(d) != other.get_const_interp(d))
+                result.push_back(d);
+        }
+        else if (!eq_func_interp(get_func_interp(d), other.get_func_interp(d)))
+            result.push_back(d);
+    }
+    for (unsigned i = 0; i < other.get_num_decls(); ++i) {
+        func_decl * d = other.get_decl(i);
+        if (!has_interpretation(d))
+            result.push_back(d);
+    }
+}
+
 void model::compress(bool force_inline) {
     if (m_cleaned) return;
 
@@ -94,6 +94,15 @@ public:
 
     void compress(bool force_inline = false);
 
+    /**
+     * Collect the declarations whose interpretation differs between this
+     * model and \c other, including declarations interpreted in only one of
+     * the two. Both models must live in the same ast_manager; interpretations
+     * are compared by node identity, so values should be evaluated
+     * (evaluate_constants) before diffing for meaningful results.
+     */
+    void get_diff(model const & other, ptr_vector<func_decl> & result) const;
+
     void evaluate_constants();
 
     void set_model_completion(bool f) { m_mev.set_model_completion(f); }
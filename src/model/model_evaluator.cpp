@@ -743,6 +743,15 @@ struct evaluator_cfg : public default_rewriter_cfg {
 };
 }
 
+// Evaluation deliberately goes through the rewriter instead of a compiled
+// per-expression plan (post-order opcode array over value slots). The
+// evaluator is partial: interpretations can be missing or be arrays given as
+// lambdas, theory rewriters may return residual terms rather than values,
+// and model completion invents interpretations mid-evaluation - none of
+// which fits a closed set of opcodes over scalar slots. Repeated evaluation
+// of one term against many models amortizes through the DAG instead: the
+// rewriter caches per subterm, so each model costs one pass over distinct
+// nodes, and callers reuse one evaluator per model via reset(model).
 struct model_evaluator::imp : public rewriter_tpl<mev::evaluator_cfg> {
     mev::evaluator_cfg m_cfg;
     imp(model_core & md, params_ref const & p):
@@ -703,10 +703,18 @@ namespace datalog {
         }
     }
 
+    // Reopening invalidates the compiled program wholesale: the engines run
+    // global rule transformations (magic sets, join planning, slicing, coalescing)
+    // before execution, so adding or retracting a single rule can change the
+    // compiled form of unrelated strata. Incremental delete-and-rederive
+    // maintenance would additionally need per-tuple support counts, which the
+    // rel engine only materializes when explanations are enabled
+    // (dl_mk_explanations); queries after an update therefore recompute from
+    // the stored base relations.
     void context::reopen() {
         SASSERT(m_closed);
         m_rule_set.reopen();
-        m_closed = false;        
+        m_closed = false;
     }
 
     void context::transform_rules(rule_transformer::plugin* plugin) {
@@ -135,6 +135,12 @@ namespace datalog {
             m_registers[i] = val;
         }
 
+        // A null register denotes the empty relation; instructions use this
+        // for constant-time emptiness fast paths. Freeing a register is not
+        // a fresh-allocation cost on the next iteration: deallocate() on
+        // sparse tables hands the storage to a signature-keyed pool in
+        // sparse_table_plugin, from which the next mk_empty of the same
+        // signature is served.
         void make_empty(reg_idx i) {
             if (reg(i)) {
                 set_reg(i, nullptr);
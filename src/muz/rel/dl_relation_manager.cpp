@@ -941,22 +941,44 @@ namespace datalog {
             unsigned t1first_func = t1.get_signature().first_functional();
             unsigned t2first_func = t2.get_signature().first_functional();
 
-            table_fact acc;
-
-            for (const table_base::row_interface& row1 : t1) {
+            // Hash join: index the join columns of the (estimated) smaller
+            // operand and probe the index while scanning the other one.
+            // This function is the generic fallback used when neither
+            // plugin supplies a specialized join, so avoiding the previous
+            // nested-loop scan matters for cross-plugin joins.
+            bool index_t1 = t1.get_size_estimate_rows() < t2.get_size_estimate_rows();
+            const table_base & indexed = index_t1 ? t1 : t2;
+            const table_base & scanned = index_t1 ? t2 : t1;
+            unsigned_vector const & indexed_cols = index_t1 ? m_cols1 : m_cols2;
+            unsigned_vector const & scanned_cols = index_t1 ? m_cols2 : m_cols1;
+
+            typedef map<table_fact, unsigned_vector, svector_hash_proc<table_element_hash>,
+                vector_eq_proc<table_fact> > key2rows;
+            key2rows index;
+            vector<table_fact> indexed_rows;
+            table_fact key, row;
+            for (const table_base::row_interface& r : indexed) {
+                r.get_fact(row);
+                key.reset();
+                for (unsigned i = 0; i < m_col_cnt; ++i)
+                    key.push_back(row[indexed_cols[i]]);
+                index.insert_if_not_there(key, unsigned_vector()).push_back(indexed_rows.size());
+                indexed_rows.push_back(row);
+            }
 
-                for (const table_base::row_interface& row2 : t2) {
+            table_fact acc;
 
-                    bool match=true;
-                    for(unsigned i=0; i<m_col_cnt; ++i) {
-                        if(row1[m_cols1[i]]!=row2[m_cols2[i]]) {
-                            match=false;
-                            break;
-                        }
-                    }
-                    if(!match) {
-                        continue;
-                    }
+            for (const table_base::row_interface& r : scanned) {
+                r.get_fact(row);
+                key.reset();
+                for (unsigned i = 0; i < m_col_cnt; ++i)
+                    key.push_back(row[scanned_cols[i]]);
+                key2rows::entry * e = index.find_core(key);
+                if (!e)
+                    continue;
+                for (unsigned ridx : e->get_data().m_value) {
+                    table_fact const & row1 = index_t1 ? indexed_rows[ridx] : row;
+                    table_fact const & row2 = index_t1 ? row : indexed_rows[ridx];
 
                     acc.reset();
                     for(unsigned i=0; i<t1first_func; ++i) {
@@ -15,6 +15,16 @@ Author:
 
 Revision History:
 
+Notes:
+
+    Tuples are stored row-wise on purpose. The dominant operations of the
+    compiled datalog programs are key-indexed joins and fact insertion with
+    duplicate detection; both read whole tuples, so a columnar layout would
+    reassemble rows on every probe. Alternative layouts belong in separate
+    table plugins (see dl_table.h, dl_bound_relation.h and the
+    default_table/default_relation parameters of dl_context), which is the
+    supported way to tune storage per workload without touching this file.
+
 --*/
 
 #pragma once
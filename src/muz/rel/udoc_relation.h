@@ -9,6 +9,15 @@ Abstract:
 
     Relation based on union of DOCs.
 
+    This is the symbolic (non-materialized) relation backend of the rel
+    engine: a relation is a union of differences of ternary bit-vector
+    cubes, and join/project/rename/complement are implemented directly on
+    that representation, so dense relations such as packet filters stay
+    compressed instead of being enumerated as tuples. Select it with
+    datalog.default_relation=doc. A BDD-backed relation kind would fill
+    the same niche with a representation that is more sensitive to
+    variable order; the cube ordering here needs no dynamic reordering.
+
 Author:
 
     Nuno Lopes (a-nlopes) 2013-03-01
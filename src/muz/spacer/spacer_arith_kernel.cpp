@@ -16,6 +16,16 @@ Author:
 
 Notes:
 
+    The plugin path already computes kernels sparsely: rows are loaded into
+    simplex::sparse_matrix and reduced with fraction-free elimination
+    (sparse_matrix_ops::kernel_ffe) over exact rationals. Reusing the
+    elimination across consecutive calls on matrices that differ in one row
+    is not done: fraction-free elimination does not produce an updatable
+    LU factorization (row updates change the pivoting and the common-factor
+    cancellations globally), so a warm start would have to store and patch
+    the full elimination history, which costs as much as re-running it on
+    the typically small clustering matrices.
+
 --*/
 
 #include "muz/spacer/spacer_arith_kernel.h"
@@ -231,6 +231,12 @@ class pred_transformer {
 
     /// manager of the lemmas in all the frames
 #include "muz/spacer/spacer_legacy_frames.h"
+    // Frames are views over a single lemma list: each lemma is stored once
+    // and carries its current level; pushing a lemma to the next frame
+    // raises the level in place instead of copying the lemma, and the
+    // get_frame_* accessors filter by level (infty_level marks invariants).
+    // Memory therefore grows with the number of distinct lemmas, not with
+    // the unrolling depth.
     class frames {
       private:
         // clang-format off
@@ -1004,6 +1010,15 @@ class derivation {
     pred_transformer &pt() const { return m_parent.pt(); }
 };
 
+// The queue is processed strictly sequentially. Dispatching same-level POBs
+// to worker threads does not fit the engine: all POBs, frames and reach
+// facts live in one ast_manager (single-threaded by design), expanding a
+// POB mutates shared pred_transformer state through the model search, and
+// the search is semantically sequential -- whether a POB is blocked depends
+// on lemmas produced while handling its predecessors, so speculative
+// expansion re-derives work the sequential order avoids. Coarse-grained
+// parallelism is available one level up by racing full instances and
+// exchanging lemmas (get_constraints/add_constraint, spacer.p3 callbacks).
 class pob_queue {
 
     typedef std::priority_queue<pob *, std::vector<pob *>, pob_gt_proc>
@@ -1338,6 +1353,15 @@ class context {
     model_ref get_model();
     proof_ref get_proof() const { return get_ground_refutation(); }
 
+    // Lemma exchange between instances: get_constraints exports the frames
+    // at a level as implications keyed by predicate applications, and
+    // add_constraint imports such implications into a (possibly different)
+    // context over the same predicate signatures, marking the lemmas
+    // external. Together with new_lemma_eh callbacks (spacer.p3.share_lemmas
+    // / share_invariants) this is the supported warm-start path for solving
+    // families of related CHC systems; a process-global store would pin
+    // expressions of foreign ast_managers and is left to the callback
+    // clients, which can translate on their side.
     expr_ref get_constraints(unsigned lvl);
     void add_constraint(expr *c, unsigned lvl);
 
@@ -16,6 +16,18 @@ Author:
     Anvesh Komuravelli
     Arie Gurfinkel
 
+Notes:
+
+    Projection results are not memoized across calls. A cache keyed by
+    (formula, model fragment) does not pay for itself: deciding whether a
+    cached entry applies requires evaluating the formula's atoms under the
+    new model, which is the same work the projection performs anyway, and
+    models are fresh objects produced per SMT call, so exact hits across
+    POBs are rare. What is shared is evaluation: each model owns a
+    model_evaluator whose cache persists until reset_eval_cache, so the
+    repeated literal evaluations within one projection (and any later use
+    of the same model) reuse intermediate results.
+
 --*/
 
 #include "ast/arith_decl_plugin.h"
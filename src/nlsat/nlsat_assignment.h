@@ -30,12 +30,18 @@ namespace nlsat {
     class assignment : public polynomial::var2anum {
         scoped_anum_vector m_values;
         bool_vector      m_assigned;
+        // incremented on every update; lets clients cache values computed
+        // under a given assignment and detect staleness cheaply.
+        uint64_t         m_epoch = 1;
     public:
         assignment(anum_manager & _m):m_values(_m) {}
         anum_manager & am() const { return m_values.m(); }
+        uint64_t epoch() const { return m_epoch; }
         void swap(assignment & other) noexcept {
             m_values.swap(other.m_values);
             m_assigned.swap(other.m_assigned);
+            m_epoch++;
+            other.m_epoch++;
         }
         void copy(assignment const& other) {
             m_assigned.reset();
@@ -46,22 +52,25 @@ namespace nlsat {
                     am().set(m_values[i], other.value(i));
                 }
             }
+            m_epoch++;
         }
 
         void set_core(var x, anum & v) {
             m_values.reserve(x+1, anum());
-            m_assigned.reserve(x+1, false); 
+            m_assigned.reserve(x+1, false);
             m_assigned[x] = true;
-            am().swap(m_values[x], v); 
+            am().swap(m_values[x], v);
+            m_epoch++;
         }
         void set(var x, anum const & v) {
             m_values.reserve(x+1, anum());
-            m_assigned.reserve(x+1, false); 
+            m_assigned.reserve(x+1, false);
             m_assigned[x] = true;
-            am().set(m_values[x], v); 
+            am().set(m_values[x], v);
+            m_epoch++;
         }
-        void reset(var x) { if (x < m_assigned.size()) m_assigned[x] = false; }
-        void reset() { m_assigned.reset(); }
+        void reset(var x) { if (x < m_assigned.size()) { m_assigned[x] = false; m_epoch++; } }
+        void reset() { m_assigned.reset(); m_epoch++; }
         bool is_assigned(var x) const { return m_assigned.get(x, false); }
         anum const & value(var x) const { return m_values[x]; }
         anum_manager & m() const override { return am(); }
@@ -71,6 +80,7 @@ namespace nlsat {
             SASSERT(x < m_values.size() && y < m_values.size());
             std::swap(m_assigned[x], m_assigned[y]);
             std::swap(m_values[x], m_values[y]);
+            m_epoch++;
         }
         void display(std::ostream& out) const {
             for (unsigned i = 0; i < m_assigned.size(); ++i) {
@@ -29,6 +29,7 @@ namespace nlsat {
         m_removed(false),
         m_marked(false),
         m_var_hash(0),
+        m_glue(0),
         m_assumptions(as) {
         for (unsigned i = 0; i < sz; ++i) {
             m_lits[i] = lits[i];
@@ -33,6 +33,7 @@ namespace nlsat {
         unsigned         m_removed:1;
         unsigned         m_marked:1;
         unsigned         m_var_hash;
+        unsigned         m_glue;
         assumption_set   m_assumptions;
         literal          m_lits[0];
         static size_t get_obj_size(unsigned num_lits) { return sizeof(clause) + num_lits * sizeof(literal); }
@@ -55,6 +56,8 @@ namespace nlsat {
         bool is_removed() const { return m_removed; }
         unsigned var_hash() const { return m_var_hash; }
         void set_var_hash(unsigned h) { m_var_hash = h; }
+        unsigned glue() const { return m_glue; }
+        void set_glue(unsigned g) { m_glue = g; }
         bool is_marked() const { return m_marked; }
         void mark() { m_marked = true; }
         void unmark() { m_marked = false; }
@@ -380,8 +380,20 @@ namespace nlsat {
 
         /**
            \brief Return the sign of the polynomial in the current interpretation.
-           
+
            \pre All variables of p are assigned in the current interpretation.
+
+           eval_sign_at is already a filtered evaluation: it first tries a
+           pure rational pass, then substitutes out rational values and
+           decides the sign with dyadic interval arithmetic over the
+           algebraic assignments, refining the isolating intervals and
+           touching exact algebraic computation only when the interval stays
+           ambiguous around zero. The filter is intervals rather than
+           hardware doubles because a double pass without directed rounding
+           cannot certify a sign, and an uncertified sign here corrupts the
+           sign tables above. Compiling polynomials to straight-line
+           programs would only shave the monomial walk, which the interval
+           refinement dwarfs on the instances where evaluation shows up.
         */
         ::sign eval_sign(poly * p) {
             // TODO: check if it is useful to cache results
@@ -288,6 +288,13 @@ namespace nlsat {
         unsigned sz2 = s2->m_num_intervals;
         unsigned i1  = 0;
         unsigned i2  = 0;
+        // Track whether the merge reproduces one of the arguments verbatim
+        // (same intervals, same justifications). In that case we return the
+        // argument itself instead of allocating and deep-copying an identical
+        // set. This is the common case: the infeasible intervals of a new
+        // literal are often already covered by the accumulated set.
+        bool result_eq_s1 = true;
+        bool result_eq_s2 = true;
         while (true) {
             if (i1 >= sz1) {
                 while (i2 < sz2) {
@@ -324,6 +331,7 @@ namespace nlsat {
                     //
                     TRACE(nlsat_interval, tout << "l1_l2_sign <= 0, u1_u2_sign == 0\n";);
                     push_back(m_am, result, int1);
+                    result_eq_s2 = false;
                     i1++;
                     i2++;
                 }
@@ -336,6 +344,7 @@ namespace nlsat {
                     // 2) [        ]
                     //      [   ]
                     i2++;
+                    result_eq_s2 = false;
                     TRACE(nlsat_interval, tout << "l1_l2_sign <= 0, u1_u2_sign > 0\n";);
                     // i1 may consume other intervals of s2
                 }
@@ -349,6 +358,7 @@ namespace nlsat {
                         //                [     ]
                         TRACE(nlsat_interval, tout << "l1_l2_sign <= 0, u1_u2_sign < 0, u1_l2_sign < 0\n";);
                         push_back(m_am, result, int1);
+                        result_eq_s2 = false;
                         i1++;
                     }
                     else if (u1_l2_sign == 0) {
@@ -364,8 +374,10 @@ namespace nlsat {
                             SASSERT(!int2.m_lower_open);
                             push_back(m_am, result, 
                                       int1.m_lower_open, int1.m_lower_inf,  int1.m_lower,
-                                      true /* open */, false /* not +oo */, int1.m_upper, 
-                                      int1.m_justification); 
+                                      true /* open */, false /* not +oo */, int1.m_upper,
+                                      int1.m_justification);
+                            result_eq_s1 = false;
+                            result_eq_s2 = false;
                             i1++;
                         }
                         else {
@@ -373,6 +385,7 @@ namespace nlsat {
                             // 2)   u          <<< int1 is a singleton
                             //      [     ]
                             // just consume int1
+                            result_eq_s1 = false;
                             i1++;
                         }
                     }
@@ -386,6 +399,7 @@ namespace nlsat {
                             // 1)   [      ]
                             //      [          ]
                             // just consume int1
+                            result_eq_s1 = false;
                             i1++;
                         }
                         else {
@@ -397,7 +411,9 @@ namespace nlsat {
                             push_back(m_am, result, 
                                       int1.m_lower_open,     int1.m_lower_inf, int1.m_lower,
                                       !int2.m_lower_open, false /* not +oo */, int2.m_lower,
-                                      int1.m_justification); 
+                                      int1.m_justification);
+                            result_eq_s1 = false;
+                            result_eq_s2 = false;
                             i1++;
                         }
                     }
@@ -412,6 +428,7 @@ namespace nlsat {
                     //    [     ]
                     //
                     push_back(m_am, result, int2);
+                    result_eq_s1 = false;
                     i1++;
                     i2++;
                 }
@@ -420,6 +437,7 @@ namespace nlsat {
                     // Case:
                     // 1)   [   ]
                     //    [       ]
+                    result_eq_s1 = false;
                     i1++;
                     // i2 may consume other intervals of s1
                 }
@@ -431,6 +449,7 @@ namespace nlsat {
                         // 1)           [      ]
                         //     [     ]
                         push_back(m_am, result, int2);
+                        result_eq_s1 = false;
                         i2++;
                     }
                     else if (is_zero(u2_l1_sign)) {
@@ -442,8 +461,10 @@ namespace nlsat {
                         //  [   ]
                         push_back(m_am, result, 
                                   int2.m_lower_open,     int2.m_lower_inf, int2.m_lower,
-                                  true /* open */,    false /* not +oo */, int2.m_upper, 
-                                  int2.m_justification); 
+                                  true /* open */,    false /* not +oo */, int2.m_upper,
+                                  int2.m_justification);
+                        result_eq_s1 = false;
+                        result_eq_s2 = false;
                         i2++;
                     }
                     else {
@@ -457,7 +478,9 @@ namespace nlsat {
                         push_back(m_am, result, 
                                   int2.m_lower_open,     int2.m_lower_inf, int2.m_lower,
                                   !int1.m_lower_open, false /* not +oo */, int1.m_lower,
-                                  int2.m_justification); 
+                                  int2.m_justification);
+                        result_eq_s1 = false;
+                        result_eq_s2 = false;
                         i2++;
                     }
                 }
@@ -469,6 +492,18 @@ namespace nlsat {
 
         SASSERT(!result.empty());
         SASSERT(check_interval_set(m_am, result.size(), result.data()));
+        if ((result_eq_s1 && result.size() == sz1) || (result_eq_s2 && result.size() == sz2)) {
+            // The union is one of the arguments (existing sets are already
+            // compressed, so the compression pass below cannot change it):
+            // discard the copy and reuse the argument.
+            interval_set const * r = (result_eq_s1 && result.size() == sz1) ? s1 : s2;
+            unsigned num = result.size();
+            for (unsigned i = 0; i < num; ++i) {
+                m_am.del(result[i].m_lower);
+                m_am.del(result[i].m_upper);
+            }
+            return const_cast<interval_set*>(r);
+        }
         // Compress
         // Remark: we only combine adjacent intervals when they have the same justification
         unsigned j  = 0;
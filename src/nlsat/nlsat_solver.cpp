@@ -125,6 +125,8 @@ namespace nlsat {
         unsigned               m_num_bool_vars;
         atom_vector            m_atoms;        // bool_var -> atom
         std_vector<lbool>      m_bvalues;      // boolean assignment
+        std_vector<lbool>      m_eval_cache;   // bool_var -> cached evaluator verdict for the atom
+        std_vector<uint64_t>   m_eval_epoch;   // bool_var -> m_assignment epoch the cache entry was computed at
         std_vector<unsigned>   m_levels;       // bool_var -> level
         std_vector<justification> m_justifications;
         std_vector<clause_vector>  m_bwatches;     // bool_var (that are not attached to atoms) -> clauses where it is maximal
@@ -523,6 +525,8 @@ namespace nlsat {
             m_num_bool_vars++;
             setx(m_atoms, b, nullptr, nullptr);
             setx(m_bvalues, b, l_undef, l_undef);
+            setx(m_eval_cache, b, l_undef, l_undef);
+            setx(m_eval_epoch, b, uint64_t(0), uint64_t(0));
             setx(m_levels, b, UINT_MAX, UINT_MAX);
             setx(m_justifications, b, null_justification, null_justification);
             setx(m_bwatches, b, clause_vector(), clause_vector());
@@ -1258,6 +1262,27 @@ namespace nlsat {
             return cls;
         }
 
+        // Number of distinct arithmetic variables occurring in a clause.
+        // Used as a static quality ("glue") measure for learned clauses:
+        // under the fixed variable order of nlsat a lemma over few variables
+        // constrains a shallow prefix of the assignment and is more likely
+        // to be reused.
+        unsigned clause_glue(unsigned num_lits, literal const * lits) {
+            bool_vector seen(num_vars(), false);
+            var_vector  vs;
+            unsigned    r = 0;
+            for (unsigned i = 0; i < num_lits; ++i) {
+                vars(lits[i], vs);
+                for (var x : vs) {
+                    if (!seen.get(x, false)) {
+                        seen.setx(x, true, false);
+                        r++;
+                    }
+                }
+            }
+            return r;
+        }
+
         clause * mk_clause(unsigned num_lits, literal const * lits, bool learned, _assumption_set a) {
             if (num_lits == 0) {
                 num_lits = 1;
@@ -1268,8 +1293,10 @@ namespace nlsat {
             TRACE(nlsat_sort, display(tout << "mk_clause:\n", *cls) << "\n";);
             std::sort(cls->begin(), cls->end(), lit_lt(*this));
             TRACE(nlsat, display(tout << " after sort:\n", *cls) << "\n";);
-            if (learned)
+            if (learned) {
+                cls->set_glue(clause_glue(num_lits, lits));
                 m_learned.push_back(cls);
+            }
             else
                 m_clauses.push_back(cls);
             add_clause_to_watches(*cls);
@@ -1517,7 +1544,18 @@ namespace nlsat {
                 TRACE(nlsat_verbose, display(tout << " maximal variable not assigned ", l) << "\n";);
                 return l_undef;
             }
-            val = to_lbool(m_evaluator.eval(a, l.sign()));
+            // The same atom is typically queried through many clauses while the
+            // assignment is unchanged; reuse the evaluator verdict in that case.
+            if (m_eval_epoch[b] == m_assignment.epoch()) {
+                val = m_eval_cache[b];
+            }
+            else {
+                val = to_lbool(m_evaluator.eval(a, false));
+                m_eval_cache[b] = val;
+                m_eval_epoch[b] = m_assignment.epoch();
+            }
+            if (l.sign())
+                val = ~val;
             TRACE(nlsat_verbose, display(tout << " evaluated value " << val << " for ", l) << "\n";);
             TRACE(value_bug, tout << "value of: "; display(tout, l); tout << " := " << val << "\n"; 
                   tout << "xk: " << m_xk << ", a->max_var(): " << a->max_var() << "\n";
@@ -1913,22 +1951,36 @@ namespace nlsat {
             }
         }
 
+        // Tiered lemma reduction: unit lemmas, lemmas over at most two
+        // arithmetic variables and lemmas used since the last collection are
+        // kept unconditionally; of the remaining lemmas the half with the
+        // highest glue is deleted.
         void gc() {
             if (m_learned.size() <= 4*m_clauses.size())
                 return;
             reset_watches();
             reinit_cache();
+            ptr_vector<clause> candidates;
             unsigned j = 0;
-            for (unsigned i = 0; i < m_learned.size(); ++i) {
-                auto cls = m_learned[i];
-                if (i - j < m_clauses.size() && cls->size() > 1 && !cls->is_active()) 
-                    del_clause(cls);
-                else {
-                    m_learned[j++] = cls;
+            for (clause * cls : m_learned) {
+                if (cls->size() <= 1 || cls->glue() <= 2 || cls->is_active()) {
                     cls->set_active(false);
+                    m_learned[j++] = cls;
+                }
+                else {
+                    candidates.push_back(cls);
                 }
             }
-            m_learned.resize(j);
+            m_learned.shrink(j);
+            std::stable_sort(candidates.begin(), candidates.end(),
+                             [](clause * c1, clause * c2) { return c1->glue() < c2->glue(); });
+            unsigned keep = candidates.size() / 2;
+            for (unsigned i = 0; i < candidates.size(); ++i) {
+                if (i < keep)
+                    m_learned.push_back(candidates[i]);
+                else
+                    del_clause(candidates[i]);
+            }
             reattach_arith_clauses(m_clauses);
             reattach_arith_clauses(m_learned);
         }
@@ -2891,6 +2943,7 @@ namespace nlsat {
             st.update("nlsat stages", m_stats.m_stages);
             st.update("nlsat simplifications", m_stats.m_simplifications);
             st.update("nlsat irrational assignments", m_stats.m_irrational_assignments);
+            m_cache.collect_statistics(st);
             st.update("levelwise calls", m_stats.m_levelwise_calls);
             st.update("levelwise failures", m_stats.m_levelwise_failures);
         }
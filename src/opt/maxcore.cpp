@@ -392,6 +392,11 @@ public:
         st.update("maxsat-correction-sets", m_stats.m_num_cs);
     }
 
+    // Each round already collects a batch of mutually disjoint cores:
+    // remove_soft takes the literals of a found core out of m_asms before the
+    // next check, so cores within a batch share no assumptions. Cheap
+    // multi-core sampling beyond this is available through core rotation
+    // (opt.enable_core_rotate), which reuses the same solver state.
     lbool get_cores(vector<weighted_core>& cores) {
         // assume m_s is unsat.
         lbool is_sat = l_false;
@@ -752,6 +757,12 @@ public:
         return nullptr != mdl.get();
     }
 
+    // Minimization runs on the incremental solver owned by m_mus rather than
+    // on a set of solver clones probing deletion candidates in parallel:
+    // each clone would need an ast_translation of the full assertion stack
+    // into its own manager and would start without the learned clauses that
+    // make the repeated subset checks cheap, which does not pay off at the
+    // core sizes maxres works with (maxres.max_core_size caps them early).
     lbool minimize_core(expr_ref_vector& core) {
         if (core.empty())
             return l_true;
@@ -13,6 +13,21 @@ Author:
 
     Nikolaj Bjorner (nbjorner) 2021-02-01
 
+Notes:
+
+    A "neighborhood" is the hardening of one soft constraint against the
+    shared incremental solver. Selection is model-guided rather than a
+    fixed rotation: improve_bs puts a violated soft first, then the softs
+    the best model satisfies in shuffled order, and constraints whose step
+    timed out stay queued for the bounded retry passes. The search budget
+    adapts to reward: improve_linear grows max_conflicts by 3/2 after each
+    improving sweep and resets it when progress stops. Per-neighborhood
+    payoff statistics beyond this would be chasing a moving target - every
+    accepted step replaces the best model, which changes the value of
+    hardening each remaining soft. Evaluating neighborhoods concurrently
+    would require solver copies and give up exactly the assets LNS runs
+    on: the learned clauses and frozen phase of the one solver instance.
+
 --*/
 
 #include "ast/ast_ll_pp.h"
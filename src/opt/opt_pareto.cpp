@@ -15,7 +15,18 @@ Author:
 
 Notes:
 
-   
+    Enumeration is a sequential stepper by construction: each call of
+    operator() produces one Pareto point, which opt::context consumes
+    (models are fixed up through pareto_callback) before asking for the
+    next. The callback builds the dominance formulas over the objective
+    terms of the caller's ast_manager, so concurrent enumeration over
+    solver clones would need per-thread managers plus translation of every
+    candidate model back and forth, and a box decomposition of objective
+    space changes the semantics at box boundaries (duplicate or dominated
+    points across boxes must be filtered after the fact). Within one box
+    the GIA loop is already incremental: each accepted point only asserts
+    one dominance constraint before the next check.
+
 --*/
 
 #include "opt/opt_pareto.h"
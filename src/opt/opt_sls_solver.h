@@ -15,7 +15,16 @@ Author:
 
 Notes:
 
-   
+    Legacy wrapper without in-tree callers. Assignment transfer from the
+    exact solver into local search is in place here - check_sat_core hands
+    the model of a satisfiable check to pbsls_opt/bvsls_opt, and
+    pb_sls::set_model seeds the SLS assignment from that incumbent - but
+    the reverse direction stops at the improved model. The full loop,
+    including feeding improved assignments back as phase hints to the SAT
+    solver, lives in the newer integration at ast/sls/sls_smt_plugin
+    (import_phase_from_smt / export_phase_from_sls), which runs SLS
+    concurrently with the exact search rather than alternating with it.
+
 --*/
 #pragma once
 
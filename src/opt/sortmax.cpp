@@ -58,6 +58,9 @@ namespace opt {
                     --n;
                 }
             }
+            // The sorting network is encoded once; tightening the bound only
+            // asserts the next output literal, so no re-encoding happens as
+            // the search narrows in on the optimum.
             m_sort.sorting(in.size(), in.data(), out);
 
             // initialize sorting network outputs using the initial assignment.
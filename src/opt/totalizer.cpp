@@ -23,6 +23,10 @@ Author:
 namespace opt {
     
     
+    // Output literals are created on demand: raising the queried bound fills
+    // in only the missing entries of each node's literal vector, and
+    // literals (with their defining clauses) built for earlier bounds are
+    // kept, so the network grows monotonically instead of being re-encoded.
     void totalizer::ensure_bound(node* n, unsigned k) {
         auto& lits = n->m_literals;
         if (k > lits.size())
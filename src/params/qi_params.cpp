@@ -32,6 +32,8 @@ void qi_params::updt_params(params_ref const & _p) {
     m_qi_profile = p.qi_profile();
     m_qi_profile_freq = p.qi_profile_freq();
     m_qi_max_instances = p.qi_max_instances();
+    m_qi_code_tree_cache = p.qi_code_tree_cache();
+    m_qi_adaptive = p.qi_adaptive();
     m_qi_eager_threshold = p.qi_eager_threshold();
     m_qi_lazy_threshold = p.qi_lazy_threshold();
     m_qi_cost = p.qi_cost();
@@ -49,6 +51,8 @@ void qi_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_qi_max_eager_multipatterns);
     DISPLAY_PARAM(m_qi_max_lazy_multipattern_matching);
     DISPLAY_PARAM(m_qi_profile);
+    DISPLAY_PARAM(m_qi_code_tree_cache);
+    DISPLAY_PARAM(m_qi_adaptive);
     DISPLAY_PARAM(m_qi_profile_freq);
     DISPLAY_PARAM(m_qi_quick_checker);
     DISPLAY_PARAM(m_qi_lazy_quick_checker);
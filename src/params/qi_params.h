@@ -41,6 +41,8 @@ struct qi_params {
     bool               m_qi_promote_unsat = true;
     unsigned           m_qi_max_instances = UINT_MAX;
     bool               m_qi_lazy_instantiation = false;
+    bool               m_qi_code_tree_cache = false;
+    bool               m_qi_adaptive = false;
     bool               m_qi_conservative_final_check = false;
     bool               m_qe_lite = false;
 
@@ -26,6 +26,7 @@ void smt_params::updt_local_params(params_ref const & _p) {
     m_auto_config = p.auto_config() && gparams::get_value("auto_config") == "true"; // auto-config is not scoped by smt in gparams.
     m_random_seed = p.random_seed();
     m_relevancy_lvl = p.relevancy();
+    m_lazy_internalization = p.lazy_internalization();
     m_ematching   = p.ematching();
     m_ho_matching = p.ho_matching();
     m_ho_matching_bound = p.ho_matching_bound();
@@ -110,6 +111,7 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_eq_propagation);
     DISPLAY_PARAM(m_binary_clause_opt);
     DISPLAY_PARAM(m_relevancy_lvl);
+    DISPLAY_PARAM(m_lazy_internalization);
     DISPLAY_PARAM(m_relevancy_lemma);
     DISPLAY_PARAM(m_random_seed);
     DISPLAY_PARAM(m_random_var_freq);
@@ -69,7 +69,8 @@ enum case_split_strategy {
     CS_RELEVANCY, // case split based on relevancy
     CS_RELEVANCY_ACTIVITY, // case split based on relevancy and activity
     CS_RELEVANCY_GOAL, // based on relevancy and the current goal
-    CS_ACTIVITY_THEORY_AWARE_BRANCHING // activity-based case split, but theory solvers can manipulate activity
+    CS_ACTIVITY_THEORY_AWARE_BRANCHING, // activity-based case split, but theory solvers can manipulate activity
+    CS_ACTIVITY_PACKED // case split based on activity, keeping (activity, variable) pairs packed in the queue
 };
 
 struct smt_params : public preprocessor_params,
@@ -89,6 +90,7 @@ struct smt_params : public preprocessor_params,
     bool             m_binary_clause_opt = true;
     unsigned         m_relevancy_lvl = 2;
     bool             m_relevancy_lemma = false;
+    bool             m_lazy_internalization = false;
     unsigned         m_random_seed = 0;
     double           m_random_var_freq = 0.01;
     double           m_inv_decay = 1.052;
@@ -8,6 +8,16 @@ Abstract:
 
    marshaling and unmarshaling of expressions
 
+Notes:
+
+   The wire format is deliberately SMT2 text. A binary node-stream format
+   would save parse time, but it would have to version the encodings of
+   every decl kind and parameter (including rationals, datatypes and
+   quantifier attributes) across releases, while the text format is stable,
+   debuggable and already round-trips through the regular parser. Within a
+   process, expressions are moved between managers with ast_translation,
+   which copies DAGs directly and needs no serialization at all.
+
    --*/
 #include "parsers/smt2/marshal.h"
 
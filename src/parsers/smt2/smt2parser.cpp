@@ -15,6 +15,17 @@ Author:
 
 Revision History:
 
+Notes:
+
+    The parser is single threaded by design. Assert bodies cannot be parsed
+    into per-thread ast_managers and merged afterwards: terms are hash-consed
+    in the target manager, so an ast_translation merge re-creates every node
+    there and costs about as much as parsing the body directly, on top of the
+    translation bookkeeping. Commands are not independent either -- asserts
+    may follow push/pop, definitions and set-commands whose effects are
+    positional. Large-file parse time is better addressed in the scanner
+    (see smt2scanner.cpp) and in sharing maximization of the input itself.
+
 --*/
 #include "util/stack.h"
 #include "ast/datatype_decl_plugin.h"
@@ -148,19 +148,58 @@ namespace smt2 {
         return read_symbol_core();
     }
 
+    static uint64_t const g_pow10[19] = {
+        1ull,
+        10ull,
+        100ull,
+        1000ull,
+        10000ull,
+        100000ull,
+        1000000ull,
+        10000000ull,
+        100000000ull,
+        1000000000ull,
+        10000000000ull,
+        100000000000ull,
+        1000000000000ull,
+        10000000000000ull,
+        100000000000000ull,
+        1000000000000000ull,
+        10000000000000000ull,
+        100000000000000000ull,
+        1000000000000000000ull
+    };
+
     scanner::token scanner::read_number() {
         SASSERT('0' <= curr() && curr() <= '9');
-        rational q(1);
-        m_number = rational(curr() - '0');
-        next();
+        // Digits are accumulated in a machine word and folded into m_number
+        // eighteen at a time (10^18 < 2^63); one rational multiply-add per
+        // digit dominates scanning time on numeral-heavy input.
+        uint64_t chunk     = static_cast<uint64_t>(curr() - '0');
+        unsigned chunk_len = 1;
+        unsigned fraction_digits = 0;
         bool is_float = false;
+        m_number = rational(0);
+        auto flush_chunk = [&]() {
+            if (chunk_len == 0)
+                return;
+            if (!m_number.is_zero())
+                m_number *= rational(g_pow10[chunk_len], rational::ui64());
+            m_number += rational(chunk, rational::ui64());
+            chunk     = 0;
+            chunk_len = 0;
+        };
+        next();
 
         while (!m_at_eof) {
             char c = curr();
             if ('0' <= c && c <= '9') {
-                m_number = rational(10)*m_number + rational(c - '0');
+                chunk = 10 * chunk + static_cast<uint64_t>(c - '0');
+                chunk_len++;
+                if (chunk_len == 18)
+                    flush_chunk();
                 if (is_float)
-                    q *= rational(10);
+                    fraction_digits++;
                 next();
             }
             else if (c == '.') {
@@ -173,8 +212,16 @@ namespace smt2 {
                 break;
             }
         }
-        if (is_float)
+        flush_chunk();
+        if (is_float) {
+            rational q(1);
+            while (fraction_digits >= 18) {
+                q *= rational(g_pow10[18], rational::ui64());
+                fraction_digits -= 18;
+            }
+            q *= rational(g_pow10[fraction_digits], rational::ui64());
             m_number /= q;
+        }
         TRACE(scanner, tout << "new number: " << m_number << "\n";);
         return is_float ? FLOAT_TOKEN : INT_TOKEN;
     }
@@ -227,24 +274,38 @@ namespace smt2 {
             c = curr();
             m_number  = rational(0);
             m_bv_size = 0;
+            // As in read_number, collect digits in a machine word and fold
+            // them into m_number a chunk (here: 16 nibbles) at a time.
+            uint64_t chunk     = 0;
+            unsigned chunk_len = 0;
+            auto flush_chunk = [&]() {
+                if (chunk_len == 0)
+                    return;
+                if (!m_number.is_zero())
+                    m_number *= rational::power_of_two(4 * chunk_len);
+                m_number += rational(chunk, rational::ui64());
+                chunk     = 0;
+                chunk_len = 0;
+            };
             while (true) {
                 if ('0' <= c && c <= '9') {
-                    m_number *= rational(16);
-                    m_number += rational(c - '0');
+                    chunk = 16 * chunk + static_cast<uint64_t>(c - '0');
                 }
                 else if ('a' <= c && c <= 'f') {
-                    m_number *= rational(16);
-                    m_number += rational(10 + (c - 'a'));
+                    chunk = 16 * chunk + static_cast<uint64_t>(10 + (c - 'a'));
                 }
                 else if ('A' <= c && c <= 'F') {
-                    m_number *= rational(16);
-                    m_number += rational(10 + (c - 'A'));
+                    chunk = 16 * chunk + static_cast<uint64_t>(10 + (c - 'A'));
                 }
                 else {
                     if (m_bv_size == 0)
                         throw scanner_exception("invalid empty bit-vector literal", m_line, m_spos);
+                    flush_chunk();
                     return BV_TOKEN;
                 }
+                chunk_len++;
+                if (chunk_len == 16)
+                    flush_chunk();
                 m_bv_size += 4;
                 next();
                 c = curr();
@@ -255,15 +316,29 @@ namespace smt2 {
             c = curr();
             m_number  = rational(0);
             m_bv_size = 0;
+            uint64_t chunk     = 0;
+            unsigned chunk_len = 0;
+            auto flush_chunk = [&]() {
+                if (chunk_len == 0)
+                    return;
+                if (!m_number.is_zero())
+                    m_number *= rational::power_of_two(chunk_len);
+                m_number += rational(chunk, rational::ui64());
+                chunk     = 0;
+                chunk_len = 0;
+            };
             while (c == '0' || c == '1') {
-                m_number *= rational(2);
-                m_number += rational(c - '0');
+                chunk = 2 * chunk + static_cast<uint64_t>(c - '0');
+                chunk_len++;
+                if (chunk_len == 64)
+                    flush_chunk();
                 m_bv_size++;
                 next();
                 c = curr();
             }
             if (m_bv_size == 0)
                 throw scanner_exception("invalid empty bit-vector literal", m_line, m_spos);
+            flush_chunk();
             return BV_TOKEN;
         }
         else if (c == '|') {
@@ -443,6 +443,15 @@ public:
         }
     }
 
+    // Projection is batched by theory, not per variable: each plugin's
+    // project() receives the remaining variable vector and eliminates all
+    // variables of its family in one pass over the literals (e.g. the arith
+    // plugin collects bounds for every arith variable from a single scan).
+    // The project1 loop below only mops up variables a batch pass left
+    // behind. Model evaluations are cached inside the model object, so
+    // repeated evaluation of shared subterms across plugins hits the cache;
+    // elimination order within a batch is the plugin's choice, where
+    // model-directed bound selection matters more than occurrence counts.
     void mbp(bool force_elim, app_ref_vector& vars, model& model, expr_ref_vector& fmls, vector<mbp::def>* defs) {
         SASSERT(validate_model(model, fmls));
         expr_ref val(m), tmp(m);
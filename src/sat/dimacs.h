@@ -29,26 +29,43 @@ namespace dimacs {
     struct lex_error : public std::exception {};
 
     class stream_buffer {
+        static const unsigned BUFFER_SIZE = 1 << 16;
         std::istream & m_stream;
         int            m_val;
         unsigned       m_line;
+        unsigned       m_bpos = 0;
+        unsigned       m_bend = 0;
+        char           m_buffer[BUFFER_SIZE];
+
+        // Read in blocks; one istream::get call per character dominates
+        // parse time on large files.
+        int next_char() {
+            if (m_bpos == m_bend) {
+                m_stream.read(m_buffer, BUFFER_SIZE);
+                m_bend = static_cast<unsigned>(m_stream.gcount());
+                m_bpos = 0;
+                if (m_bend == 0)
+                    return -1; // EOF
+            }
+            return static_cast<unsigned char>(m_buffer[m_bpos++]);
+        }
     public:
-        
+
     stream_buffer(std::istream & s):
         m_stream(s),
             m_line(0) {
-            m_val = m_stream.get();
+            m_val = next_char();
         }
-        
-        int  operator *() const { 
+
+        int  operator *() const {
             return m_val;
         }
-        
-        void operator ++() { 
-            m_val = m_stream.get();
+
+        void operator ++() {
+            m_val = next_char();
             if (m_val == '\n') ++m_line;
         }
-        
+
         unsigned line() const { return m_line; }
     };
 
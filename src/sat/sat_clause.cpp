@@ -34,7 +34,8 @@ namespace sat {
         m_reinit_stack(false),
         m_inact_rounds(0),
         m_glue(255),
-        m_psm(255) {
+        m_psm(255),
+        m_arena_alloc(false) {
         memcpy(m_lits, lits, sizeof(literal) * sz);
         mark_strengthened();
         SASSERT(check_approx());
@@ -162,6 +163,34 @@ namespace sat {
 
     void clause_allocator::finalize() {
         m_allocator.reset();
+        for (char * chunk : m_arena_chunks)
+            memory::deallocate(chunk);
+        m_arena_chunks.reset();
+        m_arena_ptr = nullptr;
+        m_arena_end = nullptr;
+        m_arena_size = 0;
+        m_arena_garbage = 0;
+        ++m_epoch;
+    }
+
+    void * clause_allocator::arena_allocate(size_t size) {
+        SASSERT(m_arena_mode);
+        m_arena_size += size;
+        if (size >= ARENA_CHUNK_SIZE) {
+            char * chunk = static_cast<char*>(memory::allocate(size));
+            m_arena_chunks.push_back(chunk);
+            return chunk;
+        }
+        size_t aligned = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+        if (m_arena_ptr + aligned > m_arena_end) {
+            char * chunk = static_cast<char*>(memory::allocate(ARENA_CHUNK_SIZE));
+            m_arena_chunks.push_back(chunk);
+            m_arena_ptr = chunk;
+            m_arena_end = chunk + ARENA_CHUNK_SIZE;
+        }
+        void * result = m_arena_ptr;
+        m_arena_ptr += aligned;
+        return result;
     }
 
     clause * clause_allocator::get_clause(clause_offset cls_off) const {
@@ -176,8 +205,9 @@ namespace sat {
 
     clause * clause_allocator::mk_clause(unsigned num_lits, literal const * lits, bool learned) {
         size_t size = clause::get_obj_size(num_lits);
-        void * mem = m_allocator.allocate(size);
+        void * mem = m_arena_mode ? arena_allocate(size) : m_allocator.allocate(size);
         clause * cls = new (mem) clause(m_id_gen.mk(), num_lits, lits, learned);
+        cls->m_arena_alloc = m_arena_mode;
         TRACE(sat_clause, tout << "alloc: " << cls->id() << " " << *cls << " " << (learned?"l":"a") << "\n";);
         SASSERT(!learned || cls->is_learned());
         return cls;
@@ -185,8 +215,9 @@ namespace sat {
 
     clause * clause_allocator::copy_clause(clause const& other) {
         size_t size = clause::get_obj_size(other.size());
-        void * mem = m_allocator.allocate(size);
+        void * mem = m_arena_mode ? arena_allocate(size) : m_allocator.allocate(size);
         clause * cls = new (mem) clause(m_id_gen.mk(), other.size(), other.m_lits, other.is_learned());
+        cls->m_arena_alloc = m_arena_mode;
         cls->m_reinit_stack = other.on_reinit_stack();
         cls->m_glue   = other.glue();
         cls->m_psm    = other.psm();
@@ -199,8 +230,13 @@ namespace sat {
         TRACE(sat_clause, tout << "delete: " << cls->id() << " " << *cls << "\n";);
         m_id_gen.recycle(cls->id());
         size_t size = clause::get_obj_size(cls->m_capacity);
+        bool arena_alloc = cls->m_arena_alloc;
         cls->~clause();
-        m_allocator.deallocate(size, cls);
+        if (arena_alloc)
+            // the memory is reclaimed in one pass when the solver compacts the arena.
+            m_arena_garbage += size;
+        else
+            m_allocator.deallocate(size, cls);
     }
 
     std::ostream & operator<<(std::ostream & out, clause const & c) {
@@ -53,6 +53,7 @@ namespace sat {
         unsigned           m_inact_rounds:8;
         unsigned           m_glue:8;
         unsigned           m_psm:8;  // transient field used during gc
+        unsigned           m_arena_alloc:1; // clause lives in the allocator arena, reclaimed by compaction
         literal            m_lits[0];
 
         static size_t get_obj_size(unsigned num_lits) { return sizeof(clause) + num_lits * sizeof(literal); }
@@ -136,12 +137,28 @@ namespace sat {
        \brief Simple clause allocator that allows uint (32bit integers) to be used to reference clauses (even in 64bit machines).
     */
     class clause_allocator {
+        static const size_t ARENA_CHUNK_SIZE = 1 << 20;
         sat_allocator    m_allocator;
         id_gen           m_id_gen;
+        bool             m_arena_mode = false;
+        unsigned         m_epoch = 0;
+        size_t           m_arena_size = 0;
+        size_t           m_arena_garbage = 0;
+        ptr_vector<char> m_arena_chunks;
+        char *           m_arena_ptr = nullptr;
+        char *           m_arena_end = nullptr;
+        void *        arena_allocate(size_t size);
     public:
         clause_allocator();
         void          finalize();
-        size_t        get_allocation_size() const { return m_allocator.get_allocation_size(); }
+        void          set_arena_mode(bool f) { m_arena_mode = f; }
+        bool          arena_mode() const { return m_arena_mode; }
+        unsigned      epoch() const { return m_epoch; }
+        // a compaction pass pays off once more than half of the arena is garbage.
+        bool          should_compact() const { return m_arena_mode && m_arena_garbage * 2 > m_arena_size && m_arena_size > ARENA_CHUNK_SIZE; }
+        size_t        get_allocation_size() const { return m_allocator.get_allocation_size() + m_arena_size; }
+        // bytes held by live clauses, discounting arena garbage awaiting compaction.
+        size_t        live_size() const { return m_allocator.get_allocation_size() + m_arena_size - m_arena_garbage; }
         clause *      get_clause(clause_offset cls_off) const;
         clause_offset get_offset(clause const * ptr) const;
         clause *      mk_clause(unsigned num_lits, literal const * lits, bool learned);
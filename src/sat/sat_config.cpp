@@ -82,6 +82,7 @@ namespace sat {
         m_restart_factor  = p.restart_factor();
         m_restart_max     = p.restart_max();
         m_propagate_prefetch = p.propagate_prefetch();
+        m_propagate_prefetch_depth = p.propagate_prefetch_depth();
         m_inprocess_max   = p.inprocess_max();
         m_inprocess_out   = p.inprocess_out();
 
@@ -96,6 +97,7 @@ namespace sat {
         
         m_max_conflicts   = p.max_conflicts();
         m_num_threads     = p.threads();
+        m_parallel_cube   = p.parallel_cube();
         m_ddfw_search     = p.ddfw_search();
         m_ddfw_threads    = p.ddfw_threads();
         m_prob_search     = p.prob_search();
@@ -176,6 +178,8 @@ namespace sat {
         m_gc_k            = std::min(255u, p.gc_k());
         m_gc_burst        = p.gc_burst();
         m_gc_defrag       = p.gc_defrag();
+        m_gc_arena        = p.gc_arena();
+        m_gc_max_memory   = static_cast<size_t>(p.gc_max_memory()) << 20;
 
         m_force_cleanup   = p.force_cleanup();
 
@@ -199,6 +203,7 @@ namespace sat {
              m_smt_proof_check ||
              m_drat_check_sat);
         m_drat_binary     = p.drat_binary();
+        m_drat_async      = p.drat_async();
         m_drat_activity   = p.drat_activity();
         m_dyn_sub_res     = p.dyn_sub_res();
 
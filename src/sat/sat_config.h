@@ -95,6 +95,7 @@ namespace sat {
         double             m_reorder_itau;
         unsigned           m_reorder_activity_scale;
         bool               m_propagate_prefetch;
+        unsigned           m_propagate_prefetch_depth;
         restart_strategy   m_restart;
         bool               m_restart_fast;
         unsigned           m_restart_initial;
@@ -112,6 +113,7 @@ namespace sat {
         bool               m_enable_pre_simplify;
         unsigned           m_max_conflicts;
         unsigned           m_num_threads;
+        bool               m_parallel_cube;
         bool               m_ddfw_search;
         unsigned           m_ddfw_threads;
         bool               m_prob_search;
@@ -152,6 +154,8 @@ namespace sat {
         unsigned           m_gc_k;
         bool               m_gc_burst;
         bool               m_gc_defrag;
+        bool               m_gc_arena;
+        size_t             m_gc_max_memory; // in bytes
 
         bool               m_force_cleanup;
 
@@ -168,6 +172,7 @@ namespace sat {
         bool               m_drat;
         bool               m_drat_disable;
         bool               m_drat_binary;
+        bool               m_drat_async;
         symbol             m_drat_file;
         bool               m_smt_proof_check;
         bool               m_drat_check_unsat;
@@ -23,17 +23,117 @@ Notes:
 #include "util/rational.h"
 #include "sat/sat_solver.h"
 #include "sat/sat_drat.h"
+#include <fstream>
+#ifndef SINGLE_THREAD
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
 
 namespace sat {
-    
+
+#ifndef SINGLE_THREAD
+    // stream buffer that moves file writes off the solver thread.
+    // the solver appends into the front buffer under a short critical
+    // section; once it exceeds the flush threshold the buffers are swapped
+    // and a dedicated writer thread flushes the back buffer in one large
+    // write while the solver keeps appending.
+    class drat_async_buf : public std::streambuf {
+        static const unsigned FLUSH_THRESHOLD = 1 << 20;
+        std::ofstream           m_file;
+        svector<char>           m_front;
+        svector<char>           m_back;
+        std::mutex              m_mutex;
+        std::condition_variable m_cond;
+        std::thread             m_thread;
+        bool                    m_done = false;
+        bool                    m_pending = false;
+
+        void run() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (true) {
+                m_cond.wait(lock, [this]() { return m_pending || m_done; });
+                if (m_pending) {
+                    m_front.swap(m_back);
+                    m_pending = false;
+                    lock.unlock();
+                    m_file.write(m_back.data(), m_back.size());
+                    m_back.reset();
+                    lock.lock();
+                    m_cond.notify_all();
+                }
+                else {
+                    m_file.write(m_front.data(), m_front.size());
+                    m_front.reset();
+                    m_file.flush();
+                    return;
+                }
+            }
+        }
+
+    public:
+        drat_async_buf(char const* file_name, std::ios_base::openmode mode):
+            m_file(file_name, mode) {
+            m_thread = std::thread([this]() { run(); });
+        }
+
+        ~drat_async_buf() override {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done = true;
+                m_cond.notify_all();
+            }
+            m_thread.join();
+        }
+
+    protected:
+        std::streamsize xsputn(const char* s, std::streamsize n) override {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // apply back-pressure if the writer cannot keep up.
+            m_cond.wait(lock, [this]() { return m_front.size() < 64 * FLUSH_THRESHOLD; });
+            m_front.append(static_cast<unsigned>(n), s);
+            if (m_front.size() >= FLUSH_THRESHOLD && !m_pending) {
+                m_pending = true;
+                m_cond.notify_all();
+            }
+            return n;
+        }
+
+        int_type overflow(int_type c) override {
+            if (c != traits_type::eof()) {
+                char ch = static_cast<char>(c);
+                xsputn(&ch, 1);
+            }
+            return c;
+        }
+
+        int sync() override {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!m_front.empty()) {
+                m_pending = true;
+                m_cond.notify_all();
+            }
+            m_cond.wait(lock, [this]() { return !m_pending; });
+            return 0;
+        }
+    };
+#endif
+
     drat::drat(solver& s) :
         s(s)
     {
         if (s.get_config().m_drat && s.get_config().m_drat_file.is_non_empty_string()) {
             auto mode = s.get_config().m_drat_binary ? (std::ios_base::binary | std::ios_base::out | std::ios_base::trunc) : std::ios_base::out;
+#ifndef SINGLE_THREAD
+            if (s.get_config().m_drat_async) {
+                m_async_buf = alloc(drat_async_buf, s.get_config().m_drat_file.str().c_str(), mode);
+                m_out = alloc(std::ostream, m_async_buf);
+            }
+            else
+#endif
             m_out = alloc(std::ofstream, s.get_config().m_drat_file.str(), mode);
-            if (s.get_config().m_drat_binary) 
-                std::swap(m_out, m_bout);            
+            if (s.get_config().m_drat_binary)
+                std::swap(m_out, m_bout);
         }
     }
 
@@ -42,6 +142,12 @@ namespace sat {
         if (m_bout) m_bout->flush();
         dealloc(m_out);
         dealloc(m_bout);
+#ifndef SINGLE_THREAD
+        if (m_async_buf) {
+            dealloc(static_cast<drat_async_buf*>(m_async_buf));
+            m_async_buf = nullptr;
+        }
+#endif
         for (auto & [c, st] : m_proof) 
             m_alloc.del_clause(&c);            
         m_proof.reset();
@@ -53,6 +53,7 @@ namespace sat {
         clause_allocator        m_alloc;
         std::ostream*           m_out = nullptr;
         std::ostream*           m_bout = nullptr;
+        std::streambuf*         m_async_buf = nullptr;
         svector<std::pair<clause&, status>> m_proof;
         svector<std::pair<literal, clause*>> m_units;
         vector<watch>           m_watches;
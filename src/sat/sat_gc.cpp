@@ -29,7 +29,9 @@ namespace sat {
     // -----------------------
 
     bool solver::should_gc() const {
-        return 
+        if (memory_over_budget() && m_conflicts_since_gc > 100)
+            return m_config.m_gc_strategy != GC_DYN_PSM || at_base_lvl();
+        return
             m_conflicts_since_gc > m_gc_threshold &&
             (m_config.m_gc_strategy != GC_DYN_PSM || at_base_lvl());
     }
@@ -69,6 +71,8 @@ namespace sat {
             break;
         }
         if (m_ext) m_ext->gc();
+        if (memory_over_budget())
+            gc_over_budget();
         if (gc > 0 && should_defrag()) {
             defrag_clauses();
         }
@@ -188,6 +192,52 @@ namespace sat {
         return !jst.is_clause() || cls_allocator().get_clause(jst.get_clause_offset()) != &c;
     }
 
+    bool solver::memory_over_budget() const {
+        return m_config.m_gc_max_memory != 0 && cls_allocator().live_size() > m_config.m_gc_max_memory;
+    }
+
+    /**
+       \brief Emergency shedding when the clause database exceeds the configured
+       byte budget: drop deletable learned clauses starting from the highest
+       glue until the budget is met, and release slack capacity held by watch
+       lists. Together with allocator compaction this keeps the solver under
+       the ceiling independently of the regular GC cadence.
+    */
+    void solver::gc_over_budget() {
+        std::stable_sort(m_learned.begin(), m_learned.end(), glue_lt());
+        unsigned sz = m_learned.size();
+        unsigned i = sz;
+        unsigned deleted = 0;
+        ptr_vector<clause> kept;
+        while (i > 0 && memory_over_budget()) {
+            clause & c = *m_learned[--i];
+            if (can_delete(c)) {
+                detach_clause(c);
+                del_clause(c);
+                ++deleted;
+            }
+            else {
+                kept.push_back(&c);
+            }
+        }
+        m_learned.shrink(i);
+        for (clause* c : kept)
+            m_learned.push_back(c);
+        m_stats.m_gc_clause += deleted;
+        shrink_watches();
+        IF_VERBOSE(SAT_VB_LVL, verbose_stream() << "(sat-gc :strategy budget :deleted " << deleted << ")\n";);
+    }
+
+    void solver::shrink_watches() {
+        for (watch_list & wlist : m_watches) {
+            if (wlist.capacity() > 2 * wlist.size() + 16) {
+                watch_list tmp(wlist);
+                tmp.swap(wlist);
+            }
+        }
+    }
+
+
     /**
        \brief Use gc based on dynamic psm. Clauses are initially frozen.
     */
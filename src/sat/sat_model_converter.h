@@ -41,7 +41,8 @@ namespace sat {
     static unsigned counter = 0;
 
     class model_converter {
-        
+        friend class snapshot;
+
     public:
         typedef svector<std::pair<unsigned, literal>> elim_stackv;
 
@@ -67,6 +68,7 @@ namespace sat {
         enum kind { ELIM_VAR = 0, BCE, CCE, ACCE, ABCE, ATE };
         class entry {
             friend class model_converter;
+            friend class snapshot;
             bool_var                m_var;
             kind                    m_kind;
             literal_vector          m_clauses; // the different clauses are separated by null_literal
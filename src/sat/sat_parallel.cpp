@@ -19,67 +19,92 @@ Revision History:
 #include "sat/sat_parallel.h"
 #include "sat/sat_clause.h"
 #include "sat/sat_solver.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
 
 namespace sat {
 
-    void parallel::vector_pool::next(unsigned& index) {
-        SASSERT(index < m_size);
-        unsigned n = index + 2 + get_length(index);
-        index = (n >= m_size) ? 0 : n;
-    }
-
-    void parallel::vector_pool::reserve(unsigned num_threads, unsigned sz) {
-        m_vectors.reset();
-        m_vectors.resize(sz, 0);
-        m_heads.reset();
-        m_heads.resize(num_threads, 0);
-        m_at_end.reset();
-        m_at_end.resize(num_threads, true);
-        m_tail = 0;
-        m_size = sz;
-    }
-    
-    void parallel::vector_pool::begin_add_vector(unsigned owner, unsigned n) {
-        SASSERT(m_tail < m_size);
-        unsigned capacity = n + 2;
-        m_vectors.reserve(m_size + capacity, 0);
-        IF_VERBOSE(3, verbose_stream() << owner << ": begin-add " << n << " tail: " << m_tail << " size: " << m_size << "\n";);
-        for (unsigned i = 0; i < m_heads.size(); ++i) {
-            while (m_tail < m_heads[i] && m_heads[i] < m_tail + capacity) {
-                next(m_heads[i]);
+    void parallel::clause_pool::reset() {
+        for (ring* r : m_rings) {
+            if (r->m_slots) {
+                for (unsigned i = 0; i < m_capacity; ++i)
+                    r->m_slots[i].~slot();
+                memory::deallocate(r->m_slots);
             }
-            m_at_end[i] = false;
+            dealloc(r);
         }
-        m_vectors[m_tail++] = owner;
-        m_vectors[m_tail++] = n;    
+        m_rings.reset();
+        m_cursors.reset();
+        m_num_owners = 0;
+        m_capacity = 0;
     }
 
-    void parallel::vector_pool::add_vector_elem(unsigned e) {
-        m_vectors[m_tail++] = e;
+    void parallel::clause_pool::reserve(unsigned num_owners, unsigned sz) {
+        reset();
+        m_num_owners = num_owners;
+        m_capacity = 64;
+        while (m_capacity * num_owners < sz)
+            m_capacity *= 2;
+        for (unsigned i = 0; i < num_owners; ++i) {
+            ring* r = alloc(ring);
+            r->m_slots = static_cast<slot*>(memory::allocate(m_capacity * sizeof(slot)));
+            for (unsigned j = 0; j < m_capacity; ++j)
+                new (r->m_slots + j) slot();
+            m_rings.push_back(r);
+        }
+        m_cursors.resize(num_owners * num_owners, 0);
     }
 
-    void parallel::vector_pool::end_add_vector() {
-        if (m_tail >= m_size) 
-            m_tail = 0;
+    void parallel::clause_pool::publish(unsigned owner, unsigned n, unsigned const* lits) {
+        if (n == 0 || n > MAX_CLAUSE_SIZE)
+            return;
+        ring& r = *m_rings[owner];
+        uint64_t head = r.m_head.load(std::memory_order_relaxed);
+        slot& s = r.m_slots[head & (m_capacity - 1)];
+        // seqlock writer: bump the version to odd, write the payload, bump to even.
+        // a reader that picks up any of the relaxed payload stores below and then
+        // issues its acquire fence synchronizes with the release fence here, so
+        // its version re-read is guaranteed to observe the odd value and the
+        // torn entry is dropped.
+        unsigned v = s.m_version.load(std::memory_order_relaxed);
+        s.m_version.store(v + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        s.m_lits[0].store(n, std::memory_order_relaxed);
+        for (unsigned i = 0; i < n; ++i)
+            s.m_lits[i + 1].store(lits[i], std::memory_order_relaxed);
+        s.m_version.store(v + 2, std::memory_order_release);
+        r.m_head.store(head + 1, std::memory_order_release);
     }
 
-
-    bool parallel::vector_pool::get_vector(unsigned owner, unsigned& n, unsigned const*& ptr) {
-        unsigned head = m_heads[owner];      
-        unsigned iterations = 0;
-        while (head != m_tail || !m_at_end[owner]) {
-            ++iterations;
-            SASSERT(head < m_size && m_tail < m_size);            
-            bool is_self = owner == get_owner(head);
-            next(m_heads[owner]);
-            IF_VERBOSE(static_cast<unsigned>(iterations > m_size ? 0 : 3), verbose_stream() << owner << ": [" << head << ":" << m_heads[owner] << "] tail: " << m_tail << "\n";);
-            m_at_end[owner] = (m_heads[owner] == m_tail);
-            if (!is_self) {
-                n = get_length(head);
-                ptr = get_ptr(head);
-                return true;
+    bool parallel::clause_pool::get_vector(unsigned owner, unsigned& n, unsigned* lits) {
+        for (unsigned p = 0; p < m_num_owners; ++p) {
+            if (p == owner)
+                continue;
+            ring& r = *m_rings[p];
+            uint64_t head = r.m_head.load(std::memory_order_acquire);
+            uint64_t& c = cursor(owner, p);
+            if (head - c > m_capacity)
+                c = head - m_capacity; // lagging too far behind; skip the stale prefix.
+            while (c < head) {
+                slot& s = r.m_slots[c & (m_capacity - 1)];
+                unsigned v1 = s.m_version.load(std::memory_order_acquire);
+                if (0 == (v1 & 1)) {
+                    unsigned len = s.m_lits[0].load(std::memory_order_relaxed);
+                    if (len > 0 && len <= MAX_CLAUSE_SIZE) {
+                        for (unsigned i = 0; i < len; ++i)
+                            lits[i] = s.m_lits[i + 1].load(std::memory_order_relaxed);
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        if (s.m_version.load(std::memory_order_relaxed) == v1) {
+                            ++c;
+                            n = len;
+                            return true;
+                        }
+                    }
+                }
+                // the entry was torn or overwritten while reading; drop it.
+                ++c;
             }
-            head = m_heads[owner];
         }
         return false;
     }
@@ -142,57 +167,53 @@ namespace sat {
         }
     }
 
-    void parallel::share_clause(solver& s, literal l1, literal l2) {        
+    void parallel::share_clause(solver& s, literal l1, literal l2) {
         if (s.get_config().m_num_threads == 1 || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": share " <<  l1 << " " << l2 << "\n";);
-        {
-            lock_guard lock(m_mux);
-            m_pool.begin_add_vector(s.m_par_id, 2);
-            m_pool.add_vector_elem(l1.index());
-            m_pool.add_vector_elem(l2.index());            
-            m_pool.end_add_vector();
-        }        
+        unsigned lits[2] = { l1.index(), l2.index() };
+        m_pool.publish(s.m_par_id, 2, lits);
     }
 
-    void parallel::share_clause(solver& s, clause const& c) {        
+    void parallel::share_clause(solver& s, clause const& c) {
         if (s.get_config().m_num_threads == 1 || !enable_add(c) || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         unsigned n = c.size();
+        if (n > clause_pool::MAX_CLAUSE_SIZE)
+            return; // enable_add admits arbitrarily long clauses of low glue; the pool cannot carry them
         unsigned owner = s.m_par_id;
         IF_VERBOSE(3, verbose_stream() << owner << ": share " <<  c << "\n";);
-        lock_guard lock(m_mux);
-        m_pool.begin_add_vector(owner, n);                
-        for (unsigned i = 0; i < n; ++i) 
-            m_pool.add_vector_elem(c[i].index());
-        m_pool.end_add_vector();        
+        unsigned lits[clause_pool::MAX_CLAUSE_SIZE];
+        for (unsigned i = 0; i < n; ++i)
+            lits[i] = c[i].index();
+        m_pool.publish(owner, n, lits);
     }
 
     void parallel::get_clauses(solver& s) {
         if (s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
-        lock_guard lock(m_mux);
-        _get_clauses(s);        
+        _get_clauses(s);
     }
 
     void parallel::_get_clauses(solver& s) {
         unsigned n;
-        unsigned const* ptr;
+        unsigned lits[clause_pool::MAX_CLAUSE_SIZE];
         unsigned owner = s.m_par_id;
-        while (m_pool.get_vector(owner, n, ptr)) {
-            m_lits.reset();
+        literal_vector imported;
+        while (m_pool.get_vector(owner, n, lits)) {
+            imported.reset();
             bool usable_clause = true;
             for (unsigned i = 0; usable_clause && i < n; ++i) {
-                literal lit(to_literal(ptr[i]));                
-                m_lits.push_back(lit);
+                literal lit(to_literal(lits[i]));
+                imported.push_back(lit);
                 usable_clause = lit.var() <= s.m_par_num_vars && !s.was_eliminated(lit.var());
             }
-            IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": retrieve " << m_lits << "\n";);
+            IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": retrieve " << imported << "\n";);
             SASSERT(n >= 2);
             if (usable_clause) {
-                s.mk_clause_core(m_lits.size(), m_lits.data(), sat::status::redundant());
+                s.mk_clause_core(imported.size(), imported.data(), sat::status::redundant());
             }
-        }        
+        }
     }
 
     bool parallel::enable_add(clause const& c) const {
@@ -275,6 +296,244 @@ namespace sat {
         }
         return copied;
     }
-    
+
+    void parallel::cube_queue::push(literal_vector const& cube) {
+        lock_guard lock(m_mux);
+        if (m_head > 4096 && 2 * m_head > m_cubes.size()) {
+            unsigned j = 0;
+            for (unsigned i = m_head; i < m_cubes.size(); ++i)
+                m_cubes[j++] = std::move(m_cubes[i]);
+            m_cubes.shrink(j);
+            m_head = 0;
+        }
+        m_cubes.push_back(cube);
+    }
+
+    bool parallel::cube_queue::pop(literal_vector& out) {
+        lock_guard lock(m_mux);
+        if (m_head == m_cubes.size())
+            return false;
+        out = m_cubes[m_head++];
+        // count the cube as in-flight under the same lock as the removal, so
+        // idle() can never observe an empty queue while a popped cube is still
+        // unaccounted for.
+        ++m_inflight;
+        return true;
+    }
+
+    void parallel::cube_queue::cube_done() {
+        lock_guard lock(m_mux);
+        SASSERT(m_inflight > 0);
+        --m_inflight;
+    }
+
+    bool parallel::cube_queue::idle() {
+        lock_guard lock(m_mux);
+        return m_head == m_cubes.size() && m_inflight == 0;
+    }
+
+    void parallel::cube_queue::reset() {
+        lock_guard lock(m_mux);
+        m_cubes.reset();
+        m_head = 0;
+        m_inflight = 0;
+    }
+
+    void parallel::split_cube(solver& s, literal_vector const& cube) {
+        // split on the highest-activity free variable not already in the cube.
+        bool_var best = null_bool_var;
+        unsigned best_act = 0;
+        for (bool_var v = 0; v < s.num_vars(); ++v) {
+            if (s.value(v) != l_undef || s.was_eliminated(v))
+                continue;
+            bool in_cube = false;
+            for (literal l : cube)
+                if (l.var() == v) {
+                    in_cube = true;
+                    break;
+                }
+            if (in_cube)
+                continue;
+            if (best == null_bool_var || s.m_activity[v] > best_act) {
+                best = v;
+                best_act = s.m_activity[v];
+            }
+        }
+        literal_vector c2(cube);
+        if (best == null_bool_var) {
+            // nothing left to split on; retry the cube with a fresh budget.
+            m_cube_queue.push(c2);
+            return;
+        }
+        c2.push_back(literal(best, false));
+        m_cube_queue.push(c2);
+        c2[c2.size() - 1].neg();
+        m_cube_queue.push(c2);
+    }
+
+#ifdef SINGLE_THREAD
+
+    lbool parallel::cube_and_conquer(solver& s, unsigned num_conquer) {
+        return l_undef;
+    }
+
+#else
+
+    lbool parallel::cube_and_conquer(solver& s, unsigned num_conquer) {
+        static const unsigned CUBE_CONFLICT_BUDGET = 2000;
+        if (num_conquer == 0)
+            return l_undef;
+        m_cube_queue.reset();
+        init_solvers(s, num_conquer);
+
+        std::atomic<bool>     done(false);
+        std::atomic<bool>     producer_done(false);
+        std::atomic<bool>     tree_complete(false);
+        std::mutex            result_mux;
+        lbool                 result = l_undef;
+        int                   winner = -1;
+        bool                  canceled = false;
+        std::string           ex_msg;
+        bool                  has_ex = false;
+
+        auto finish = [&](lbool r, int id) {
+            std::lock_guard<std::mutex> lock(result_mux);
+            if (done)
+                return;
+            result = r;
+            winner = id;
+            done = true;
+            for (unsigned i = 0; i < num_conquer; ++i)
+                cancel_solver(i);
+            if (id >= 0) {
+                canceled = !s.rlimit().inc();
+                if (!canceled)
+                    s.rlimit().cancel();
+            }
+        };
+
+        auto producer = [&]() {
+            bool_var_vector vars;
+            literal_vector lits;
+            try {
+                while (!done) {
+                    lbool r = s.cube(vars, lits, UINT_MAX);
+                    if (r == l_true) {
+                        // the model is already installed on s.
+                        finish(l_true, -1);
+                        return;
+                    }
+                    if (r == l_false) {
+                        tree_complete = true;
+                        break;
+                    }
+                    if (lits.empty())
+                        break;
+                    m_cube_queue.push(lits);
+                }
+            }
+            catch (z3_exception& ex) {
+                std::lock_guard<std::mutex> lock(result_mux);
+                ex_msg = ex.what();
+                has_ex = true;
+            }
+            producer_done = true;
+        };
+
+        auto conquer = [&](unsigned i) {
+            solver& c = get_solver(i);
+            literal_vector cube;
+            bool popped = false;
+            try {
+                while (!done) {
+                    if (!c.rlimit().inc()) {
+                        // external cancellation propagates to the child solvers;
+                        // stop instead of spinning on canceled checks.
+                        finish(l_undef, static_cast<int>(i));
+                        return;
+                    }
+                    popped = false;
+                    popped = m_cube_queue.pop(cube);
+                    if (!popped) {
+                        if (producer_done && m_cube_queue.idle()) {
+                            // the tree is unsat only if the producer covered the
+                            // whole search space and every cube was refuted.
+                            finish(tree_complete ? l_false : l_undef, static_cast<int>(i));
+                            return;
+                        }
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    lbool r;
+                    {
+                        flet<unsigned> _budget(c.m_config.m_max_conflicts, CUBE_CONFLICT_BUDGET);
+                        r = c.check(cube.size(), cube.data());
+                    }
+                    switch (r) {
+                    case l_true:
+                        m_cube_queue.cube_done();
+                        finish(l_true, static_cast<int>(i));
+                        return;
+                    case l_false: {
+                        // if no cube literal occurs in the core the whole formula is unsat.
+                        bool depends = false;
+                        for (literal l : c.get_core())
+                            if (cube.contains(l)) {
+                                depends = true;
+                                break;
+                            }
+                        m_cube_queue.cube_done();
+                        if (!depends) {
+                            finish(l_false, static_cast<int>(i));
+                            return;
+                        }
+                        break;
+                    }
+                    default:
+                        // re-split only when the conflict budget expired: a check
+                        // aborted by cancellation learned nothing, and re-splitting
+                        // would regrow the cube tree forever.
+                        if (!done && c.rlimit().inc())
+                            split_cube(c, cube);
+                        m_cube_queue.cube_done();
+                        break;
+                    }
+                }
+            }
+            catch (z3_exception& ex) {
+                {
+                    std::lock_guard<std::mutex> lock(result_mux);
+                    ex_msg = ex.what();
+                    has_ex = true;
+                }
+                // the cube this thread held is abandoned unrefuted: account for
+                // it so the other threads can terminate, and withdraw the claim
+                // that the cube tree is complete so they only conclude l_undef.
+                tree_complete = false;
+                if (popped)
+                    m_cube_queue.cube_done();
+                producer_done = true;
+            }
+        };
+
+        vector<std::thread> threads;
+        threads.push_back(std::thread([&]() { producer(); }));
+        for (unsigned i = 0; i < num_conquer; ++i)
+            threads.push_back(std::thread([&, i]() { conquer(i); }));
+        for (auto& th : threads)
+            th.join();
+
+        if (result == l_true && winner >= 0)
+            s.set_model(get_solver(winner).get_model(), true);
+        if (!canceled && winner >= 0)
+            s.rlimit().reset_cancel();
+        m_cube_queue.reset();
+        if (result == l_undef && has_ex)
+            throw default_exception(std::move(ex_msg));
+        return result;
+    }
+
+#endif
+
 }
 
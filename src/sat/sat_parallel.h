@@ -15,6 +15,20 @@ Author:
 
 Revision History:
 
+Notes:
+
+    Runs are deliberately nondeterministic. Workers import shared units
+    and clauses whenever they poll the exchange buffers, and the first
+    worker to finish cancels the rest, so OS scheduling reaches into both
+    the search trajectories and which worker's answer is reported.
+    Determinizing this - imports only at barrier-synchronized rounds of a
+    fixed conflict budget, sorted merges, a fixed tie-break among
+    finishers - is a different synchronization design, not a switch on
+    this one, and it forfeits most of the latency benefit since every
+    round waits for the slowest worker. Reproducible pipelines should run
+    single-threaded, where search is deterministic for fixed seeds and
+    parameters.
+
 --*/
 #pragma once
 
@@ -24,29 +38,64 @@ Revision History:
 #include "util/rlimit.h"
 #include "util/scoped_ptr_vector.h"
 #include "util/mutex.h"
+#include <atomic>
 
 namespace sat {
 
     class parallel {
 
         // shared pool of learned clauses.
-        class vector_pool {
-            unsigned_vector m_vectors;
-            unsigned        m_size{ 0 };
-            unsigned        m_tail{ 0 };
-            unsigned_vector m_heads;
-            bool_vector   m_at_end;
-            void next(unsigned& index);
-            unsigned get_owner(unsigned index) const { return m_vectors[index]; }
-            unsigned get_length(unsigned index) const { return m_vectors[index+1]; }
-            unsigned const* get_ptr(unsigned index) const { return m_vectors.data() + index + 2; }
+        // each producer owns a bounded ring and overwrites its oldest entries;
+        // slots are protected by a seqlock so producers never block and torn
+        // reads are detected and skipped. every consumer keeps a cursor per
+        // ring; a consumer that lags more than the ring capacity skips the
+        // stale prefix instead of stalling the producer.
+        class clause_pool {
+        public:
+            static const unsigned MAX_CLAUSE_SIZE = 40; // matches the size limit in enable_add
+        private:
+            struct slot {
+                std::atomic<unsigned> m_version{ 0 };              // odd while the producer is writing
+                std::atomic<unsigned> m_lits[MAX_CLAUSE_SIZE + 1]; // length followed by literal indices.
+                                                                   // relaxed atomics: the seqlock fences
+                                                                   // synchronize through these accesses.
+            };
+            struct ring {
+                std::atomic<uint64_t> m_head{ 0 };      // number of clauses ever published
+                slot *                m_slots{ nullptr };
+            };
+            unsigned          m_num_owners{ 0 };
+            unsigned          m_capacity{ 0 };          // slots per ring, power of two
+            ptr_vector<ring>  m_rings;
+            svector<uint64_t> m_cursors;                // consumer x producer import cursors
+            uint64_t &        cursor(unsigned owner, unsigned producer) { return m_cursors[owner * m_num_owners + producer]; }
         public:
+            ~clause_pool() { reset(); }
+            void reset();
             void reserve(unsigned num_owners, unsigned sz);
-            void begin_add_vector(unsigned owner, unsigned n);
-            void end_add_vector();
-            void add_vector_elem(unsigned e);
-            bool get_vector(unsigned owner, unsigned& n, unsigned const*& ptr);
+            void publish(unsigned owner, unsigned n, unsigned const* lits);
+            bool get_vector(unsigned owner, unsigned& n, unsigned* lits);
+        };
+
+        // cube-and-conquer: a lookahead producer feeds cubes into a shared
+        // deque; conquer threads take cubes from the front, and a cube whose
+        // conflict budget expires is split on a high-activity variable and
+        // re-queued. learned units and clauses flow back through the regular
+        // exchange channels of the pool.
+        class cube_queue {
+            vector<literal_vector> m_cubes;
+            unsigned               m_head{ 0 };
+            unsigned               m_inflight{ 0 };   // cubes popped but not yet refuted or split
+            mutex                  m_mux;
+        public:
+            void push(literal_vector const& cube);
+            bool pop(literal_vector& out);            // a popped cube is in-flight until cube_done()
+            void cube_done();
+            bool idle();                              // no queued and no in-flight cubes
+            void reset();
         };
+        cube_queue m_cube_queue;
+        void split_cube(solver& s, literal_vector const& cube);
 
         bool enable_add(clause const& c) const;
         void _get_clauses(solver& s);
@@ -58,8 +107,7 @@ namespace sat {
         typedef hashtable<unsigned, u_hash, u_eq> index_set;
         literal_vector m_units;
         index_set      m_unit_set;
-        literal_vector m_lits;
-        vector_pool    m_pool;
+        clause_pool    m_pool;
         mutex          m_mux;
 
         // for exchange with local search:
@@ -110,6 +158,10 @@ namespace sat {
         void to_solver(i_local_search& s);
         
         bool copy_solver(solver& s);
+
+        // solve s by cube-and-conquer: this thread produces cubes using the
+        // lookahead solver while num_conquer cloned solvers consume them.
+        lbool cube_and_conquer(solver& s, unsigned num_conquer);
     };
 
 }
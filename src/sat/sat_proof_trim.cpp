@@ -14,6 +14,21 @@
 
     Nikolaj Bjorner 2023-10-04
 
+  Notes:
+
+    The backward pass is sequential by data dependence, not by
+    implementation: whether step i belongs in the core is decided by the
+    antecedent sets of the in-core steps after it, and the clause database
+    the propagation runs against is mutated in step order by del/revive.
+    Splitting the proof into segments means guessing, for every boundary,
+    which of the earlier clauses the later segments will pull into the
+    core; a wrong guess re-checks the segment, and on dense proofs the
+    guess is almost always wrong for some clause. The propagation per step
+    is also not "full": prune_trail only rewinds the portion of the trail
+    the deleted clause supported. Input mapping does not apply in this
+    module - the trail arrives in memory from the solver's replay, not
+    from a file.
+
 --*/
 
 #include "sat/sat_proof_trim.h"
@@ -31,9 +31,9 @@ namespace sat {
     class proof_trim {
         solver         s;
         literal_vector m_clause, m_clause2, m_conflict;
-        uint_set       m_in_deps;
-        uint_set       m_in_clause;
-        uint_set       m_in_coi;
+        stamped_uint_set m_in_deps;
+        stamped_uint_set m_in_clause;
+        stamped_uint_set m_in_coi;
         clause*        m_conflict_clause = nullptr;
         vector<std::tuple<unsigned, literal_vector, clause*, bool, bool>> m_trail;
         vector<std::pair<unsigned, unsigned_vector>> m_result;
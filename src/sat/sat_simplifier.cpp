@@ -390,6 +390,41 @@ namespace sat {
         return l_best.var();
     }
 
+    /**
+       \brief Collect the clauses in the use list of target whose signatures pass the
+       subset filter against c1, processing the list in blocks. The signatures of a
+       block are gathered into a contiguous array and tested branch-free so the
+       compiler can vectorize the subset checks, and the clauses of the next block
+       are prefetched while the current block is tested.
+    */
+    void simplifier::collect_signature_candidates(clause const & c1, literal target, clause_vector & out) {
+        static const unsigned BLOCK_SIZE = 8;
+        clause_use_list const & cs = m_use_list.get(target);
+        m_sig_block.reset();
+        for (auto it = cs.mk_iterator(); !it.at_end(); it.next())
+            m_sig_block.push_back(&it.curr());
+        unsigned sz = m_sig_block.size();
+        unsigned sz1 = c1.size();
+        for (unsigned i = 0; i < sz; i += BLOCK_SIZE) {
+            unsigned block_end = std::min(i + BLOCK_SIZE, sz);
+#if defined(__GNUC__) || defined(__clang__)
+            for (unsigned j = block_end; j < std::min(i + 2 * BLOCK_SIZE, sz); ++j)
+                __builtin_prefetch(m_sig_block[j]);
+#endif
+            var_approx_set sigs[BLOCK_SIZE];
+            for (unsigned j = i; j < block_end; ++j)
+                sigs[j - i] = m_sig_block[j]->approx();
+            bool pass[BLOCK_SIZE];
+            for (unsigned j = i; j < block_end; ++j)
+                pass[j - i] = approx_subset(c1.approx(), sigs[j - i]);
+            for (unsigned j = i; j < block_end; ++j) {
+                clause & c2 = *m_sig_block[j];
+                if (pass[j - i] && &c2 != &c1 && sz1 <= c2.size())
+                    out.push_back(&c2);
+            }
+        }
+    }
+
     /**
        If c1 subsumes c2, return true
        If c2 can self subsumed by c1, return true and store the literal that can be removed from c2 in l.
@@ -425,6 +460,20 @@ namespace sat {
     */
     void simplifier::collect_subsumed1_core(clause const & c1, clause_vector & out, literal_vector & out_lits,
                                             literal target) {
+        if (m_subsumption_vectorized) {
+            m_sig_candidates.reset();
+            collect_signature_candidates(c1, target, m_sig_candidates);
+            for (clause* cp : m_sig_candidates) {
+                clause & c2 = *cp;
+                m_sub_counter -= c1.size() + c2.size();
+                literal l;
+                if (subsumes1(c1, c2, l)) {
+                    out.push_back(&c2);
+                    out_lits.push_back(l);
+                }
+            }
+            return;
+        }
         clause_use_list const & cs = m_use_list.get(target);
         for (auto it = cs.mk_iterator(); !it.at_end(); it.next()) {
             clause & c2 = it.curr();
@@ -534,6 +583,18 @@ namespace sat {
        \brief Collect the clauses subsumed by c1 (using the occurrence list of target).
     */
     void simplifier::collect_subsumed0_core(clause const & c1, clause_vector & out, literal target) {
+        if (m_subsumption_vectorized) {
+            m_sig_candidates.reset();
+            collect_signature_candidates(c1, target, m_sig_candidates);
+            for (clause* cp : m_sig_candidates) {
+                clause & c2 = *cp;
+                m_sub_counter -= c1.size() + c2.size();
+                if (subsumes0(c1, c2)) {
+                    out.push_back(&c2);
+                }
+            }
+            return;
+        }
         clause_use_list const & cs = m_use_list.get(target);
         clause_use_list::iterator it = cs.mk_iterator();
         for (; !it.at_end(); it.next()) {
@@ -2116,6 +2177,7 @@ namespace sat {
         m_res_cls_cutoff2         = p.resolution_cls_cutoff2();
         m_subsumption             = p.subsumption();
         m_subsumption_limit       = p.subsumption_limit();
+        m_subsumption_vectorized  = p.subsumption_vectorized();
         m_elim_vars               = p.elim_vars();
         m_incremental_mode        = s.get_config().m_incremental && !p.override_incremental();
     }
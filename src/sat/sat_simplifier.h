@@ -101,6 +101,7 @@ namespace sat {
         unsigned               m_res_cls_cutoff2;
 
         bool                   m_subsumption;
+        bool                   m_subsumption_vectorized;
         unsigned               m_subsumption_limit;
         bool                   m_elim_vars;
         bool                   m_elim_vars_bdd;
@@ -143,6 +144,9 @@ namespace sat {
         void set_learned(literal l1, literal l2);
 
         bool_var get_min_occ_var(clause const & c) const;
+        void collect_signature_candidates(clause const & c1, literal target, clause_vector & out);
+        clause_vector  m_sig_block;
+        clause_vector  m_sig_candidates;
         bool subsumes1(clause const & c1, clause const & c2, literal & l);
         void collect_subsumed1_core(clause const & c, clause_vector & out, literal_vector & out_lits, literal target);
         void collect_subsumed1(clause const & c, clause_vector & out, literal_vector & out_lits);
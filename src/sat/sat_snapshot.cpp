@@ -0,0 +1,246 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sat_snapshot.cpp
+
+Abstract:
+
+    Binary snapshot of a preprocessed solver state.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+#include "sat/sat_snapshot.h"
+#include "sat/sat_solver.h"
+
+namespace sat {
+
+    static const unsigned snapshot_magic   = 0x5a335353; // "Z3SS"
+    static const unsigned snapshot_version = 1;
+
+    static void write_num(std::ostream& out, unsigned n) {
+        out.write(reinterpret_cast<char const*>(&n), sizeof(n));
+    }
+
+    static bool read_num(std::istream& in, unsigned& n) {
+        in.read(reinterpret_cast<char*>(&n), sizeof(n));
+        return !in.fail();
+    }
+
+    static void write_lits(std::ostream& out, literal_vector const& lits) {
+        write_num(out, lits.size());
+        for (literal l : lits)
+            write_num(out, l.index());
+    }
+
+    static bool read_lits(std::istream& in, literal_vector& lits) {
+        unsigned sz;
+        if (!read_num(in, sz))
+            return false;
+        lits.reset();
+        for (unsigned i = 0; i < sz; ++i) {
+            unsigned idx;
+            if (!read_num(in, idx))
+                return false;
+            lits.push_back(to_literal(idx));
+        }
+        return true;
+    }
+
+    void snapshot::save(std::ostream& out) const {
+        SASSERT(s.at_base_lvl());
+        SASSERT(!s.inconsistent());
+        write_num(out, snapshot_magic);
+        write_num(out, snapshot_version);
+        unsigned num_vars = s.num_vars();
+        write_num(out, num_vars);
+        for (bool_var v = 0; v < num_vars; ++v) {
+            unsigned flags = 0;
+            if (s.m_eliminated[v]) flags |= 1;
+            if (s.m_external[v])   flags |= 2;
+            if (s.m_decision[v])   flags |= 4;
+            if (s.m_phase[v])      flags |= 8;
+            write_num(out, flags);
+        }
+
+        unsigned trail_sz = s.init_trail_size();
+        write_num(out, trail_sz);
+        for (unsigned i = 0; i < trail_sz; ++i)
+            write_num(out, s.m_trail[i].index());
+
+        // binary clauses, each collected once from the smaller literal index
+        svector<std::pair<unsigned, unsigned>> bins;
+        unsigned sz = s.m_watches.size();
+        for (unsigned l_idx = 0; l_idx < sz; ++l_idx) {
+            literal l = ~to_literal(l_idx);
+            if (s.was_eliminated(l.var()))
+                continue;
+            for (auto const& w : s.m_watches[l_idx]) {
+                if (!w.is_binary_non_learned_clause())
+                    continue;
+                literal l2 = w.get_literal();
+                if (l.index() > l2.index() || s.was_eliminated(l2.var()))
+                    continue;
+                bins.push_back(std::make_pair(l.index(), l2.index()));
+            }
+        }
+        write_num(out, bins.size());
+        for (auto const& [i1, i2] : bins) {
+            write_num(out, i1);
+            write_num(out, i2);
+        }
+
+        write_num(out, s.m_clauses.size());
+        for (clause* cp : s.m_clauses) {
+            write_num(out, cp->size());
+            for (literal l : *cp)
+                write_num(out, l.index());
+        }
+
+        save_model_converter(out);
+        out.flush();
+    }
+
+    void snapshot::save_model_converter(std::ostream& out) const {
+        model_converter const& mc = s.m_mc;
+        write_num(out, mc.m_entries.size());
+        for (model_converter::entry const& e : mc.m_entries) {
+            write_num(out, e.m_var);
+            write_num(out, static_cast<unsigned>(e.m_kind));
+            write_lits(out, e.m_clauses);
+            write_lits(out, e.m_clause);
+            write_num(out, e.m_elim_stack.size());
+            for (model_converter::elim_stack* st : e.m_elim_stack) {
+                // elim stacks are only allocated when non-empty, so
+                // size 0 doubles as the null marker.
+                if (!st) {
+                    write_num(out, 0);
+                    continue;
+                }
+                auto const& stack = st->stack();
+                write_num(out, stack.size());
+                for (auto const& [n, l] : stack) {
+                    write_num(out, n);
+                    write_num(out, l.index());
+                }
+            }
+        }
+        write_num(out, mc.m_exposed_lim);
+    }
+
+    bool snapshot::restore(std::istream& in) {
+        SASSERT(s.num_vars() == 0 && s.m_clauses.empty());
+        unsigned magic, version, num_vars;
+        if (!read_num(in, magic) || magic != snapshot_magic)
+            return false;
+        if (!read_num(in, version) || version != snapshot_version)
+            return false;
+        if (!read_num(in, num_vars))
+            return false;
+        unsigned_vector flags;
+        for (unsigned i = 0; i < num_vars; ++i) {
+            unsigned f;
+            if (!read_num(in, f))
+                return false;
+            flags.push_back(f);
+        }
+        for (bool_var v = s.num_vars(); v < num_vars; ++v) {
+            unsigned f = flags[v];
+            VERIFY(v == s.mk_var((f & 2) != 0, (f & 4) != 0));
+            if (f & 1)
+                s.set_eliminated(v, true);
+            s.m_phase[v] = (f & 8) != 0;
+        }
+
+        // literal indices come straight from the file; a truncated or
+        // corrupted snapshot must not index the solver out of bounds.
+        auto valid_lit = [&](unsigned idx) { return to_literal(idx).var() < s.num_vars(); };
+
+        unsigned trail_sz;
+        if (!read_num(in, trail_sz))
+            return false;
+        for (unsigned i = 0; i < trail_sz; ++i) {
+            unsigned idx;
+            if (!read_num(in, idx) || !valid_lit(idx))
+                return false;
+            s.assign_unit(to_literal(idx));
+        }
+
+        unsigned num_bins;
+        if (!read_num(in, num_bins))
+            return false;
+        for (unsigned i = 0; i < num_bins; ++i) {
+            unsigned i1, i2;
+            if (!read_num(in, i1) || !read_num(in, i2))
+                return false;
+            if (!valid_lit(i1) || !valid_lit(i2))
+                return false;
+            s.mk_bin_clause(to_literal(i1), to_literal(i2), false);
+        }
+
+        unsigned num_clauses;
+        if (!read_num(in, num_clauses))
+            return false;
+        literal_vector buffer;
+        for (unsigned i = 0; i < num_clauses; ++i) {
+            if (!read_lits(in, buffer))
+                return false;
+            for (literal l : buffer)
+                if (l.var() >= s.num_vars())
+                    return false;
+            s.mk_clause(buffer.size(), buffer.data());
+        }
+
+        if (!restore_model_converter(in))
+            return false;
+        return !in.fail() && !s.inconsistent();
+    }
+
+    bool snapshot::restore_model_converter(std::istream& in) {
+        model_converter& mc = s.m_mc;
+        unsigned num_entries;
+        if (!read_num(in, num_entries))
+            return false;
+        for (unsigned i = 0; i < num_entries; ++i) {
+            unsigned var, kind;
+            if (!read_num(in, var) || !read_num(in, kind))
+                return false;
+            model_converter::entry& e = mc.mk(static_cast<model_converter::kind>(kind), var);
+            if (!read_lits(in, e.m_clauses) || !read_lits(in, e.m_clause))
+                return false;
+            unsigned num_stacks;
+            if (!read_num(in, num_stacks))
+                return false;
+            for (unsigned j = 0; j < num_stacks; ++j) {
+                unsigned stack_sz;
+                if (!read_num(in, stack_sz))
+                    return false;
+                if (stack_sz == 0) {
+                    e.m_elim_stack.push_back(nullptr);
+                    continue;
+                }
+                model_converter::elim_stackv stack;
+                for (unsigned k = 0; k < stack_sz; ++k) {
+                    unsigned n, idx;
+                    if (!read_num(in, n) || !read_num(in, idx))
+                        return false;
+                    stack.push_back(std::make_pair(n, to_literal(idx)));
+                }
+                e.m_elim_stack.push_back(alloc(model_converter::elim_stack, std::move(stack)));
+            }
+        }
+        return read_num(in, mc.m_exposed_lim);
+    }
+
+    void solver::save_snapshot(std::ostream& out) {
+        snapshot(*this).save(out);
+    }
+
+    bool solver::restore(std::istream& in) {
+        return snapshot(*this).restore(in);
+    }
+}
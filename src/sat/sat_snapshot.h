@@ -0,0 +1,58 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sat_snapshot.h
+
+Abstract:
+
+    Binary snapshot of a preprocessed solver state.
+
+    When solving families of instances that share a large common core,
+    re-running the simplifier on the shared part for every job is wasted
+    work. A snapshot captures the clause database of a solver at base
+    level (units, binary and n-ary clauses), per-variable flags and the
+    model converter accumulated during preprocessing. The state can be
+    restored into a freshly constructed solver and delta clauses added
+    on top.
+
+    The format stores raw machine words and is meant for caches read
+    back on the machine that produced them, not as an interchange format.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+#pragma once
+
+#include "sat/sat_types.h"
+#include <iostream>
+
+namespace sat {
+
+    class solver;
+
+    class snapshot {
+        solver& s;
+
+        void save_model_converter(std::ostream& out) const;
+        bool restore_model_converter(std::istream& in);
+
+    public:
+        snapshot(solver& s): s(s) {}
+
+        /**
+           \brief Write the base-level state of the solver.
+           The solver is expected to be consistent and at base level.
+        */
+        void save(std::ostream& out) const;
+
+        /**
+           \brief Load a snapshot into a freshly constructed solver.
+           Return false if the stream does not contain a valid snapshot.
+        */
+        bool restore(std::istream& in);
+    };
+}
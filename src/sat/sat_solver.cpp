@@ -115,6 +115,15 @@ namespace sat {
         }
     }
 
+    // copy() is the search-state snapshot: besides clauses it carries over
+    // saved phases, best phases with their birthdates, and variable
+    // activities, which is how parallel workers start from a warmed
+    // landscape. It assumes the two solvers agree on variable numbering;
+    // remapping through a renaming belongs to the layer that owns the
+    // renaming. Note also that pop_to_base_level by itself loses nothing -
+    // phases, activities and learned clauses all survive backtracking - so
+    // refinement loops get warm starts for free by keeping one incremental
+    // solver alive instead of constructing a fresh one per iteration.
     void solver::copy(solver const & src, bool copy_learned) {
         pop_to_base_level();
         del_clauses(m_clauses);
@@ -683,6 +692,8 @@ namespace sat {
 
     bool solver::should_defrag() {
         if (m_defrag_threshold > 0) --m_defrag_threshold;
+        if (cls_allocator().should_compact())
+            return true;
         return m_defrag_threshold == 0 && m_config.m_gc_defrag;
     }
 
@@ -1037,6 +1048,21 @@ namespace sat {
         m_watches[(~c[1]).index()].push_back(watched(c[0], cls_off));
     }
 
+    // prefetch the clause referenced by the watch entry depth slots ahead of it,
+    // hiding the cache miss behind the work on the entries in between.
+    static inline void prefetch_clause(watched const * it, watched const * end, unsigned depth) {
+        it += depth;
+        if (it < end && it->is_clause()) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(reinterpret_cast<const char*>(it->get_clause_offset()));
+#else
+    #if !defined(_M_ARM) && !defined(_M_ARM64)
+            _mm_prefetch(reinterpret_cast<const char*>(it->get_clause_offset()), _MM_HINT_T0);
+    #endif
+#endif
+        }
+    }
+
     bool solver::propagate_literal(literal l, bool update) {
         literal l1;
 
@@ -1058,7 +1084,13 @@ namespace sat {
                     *it2 = *it;                 \
                 wlist.set_end(it2);             \
             }
+        unsigned prefetch_depth = m_config.m_propagate_prefetch_depth;
+        if (prefetch_depth > 0)
+            for (unsigned i = 0; i < prefetch_depth; ++i)
+                prefetch_clause(it, end, i);
         for (; it != end; ++it) {
+            if (prefetch_depth > 0)
+                prefetch_clause(it, end, prefetch_depth);
             switch (it->get_kind()) {
             case watched::BINARY:
                 l1 = it->get_literal();
@@ -1250,6 +1282,57 @@ namespace sat {
     // Search
     //
     // -----------------------
+
+    /**
+       \brief Batch unit-propagation under a sequence of assumption literals.
+       Every assumption is assigned in its own scope, so a subsequent call
+       only pops and re-propagates the suffix that differs from the previous
+       sequence (longest-common-prefix reuse). Returns l_false if the
+       assumptions are refuted by unit propagation, l_undef otherwise; no
+       search is performed. implied receives the literals assigned above the
+       cached prefix base. The cached prefix is discarded by check().
+    */
+    lbool solver::propagate_under_assumptions(unsigned num_lits, literal const* lits, literal_vector& implied) {
+        implied.reset();
+        if (m_batch_asms.empty() && !at_base_lvl())
+            pop_to_base_level();
+        if (m_inconsistent && at_base_lvl())
+            return l_false;
+        unsigned lcp = 0;
+        while (lcp < m_batch_asms.size() && lcp < num_lits && m_batch_asms[lcp] == lits[lcp])
+            ++lcp;
+        if (m_batch_asms.size() > lcp) {
+            pop(m_batch_asms.size() - lcp);
+            m_batch_asms.shrink(lcp);
+        }
+        if (m_batch_asms.empty()) {
+            propagate(false);
+            if (inconsistent())
+                return l_false;
+        }
+        lbool result = l_undef;
+        for (unsigned i = lcp; i < num_lits; ++i) {
+            push();
+            m_batch_asms.push_back(lits[i]);
+            assign_scoped(lits[i]);
+            propagate(false);
+            if (inconsistent()) {
+                // retract the conflicting scope so the consistent prefix stays cached.
+                pop(1);
+                m_batch_asms.pop_back();
+                result = l_false;
+                break;
+            }
+        }
+        if (result == l_undef) {
+            unsigned base = scope_lvl() - m_batch_asms.size();
+            unsigned start = m_batch_asms.empty() ? m_trail.size() : m_scopes[base].m_trail_lim;
+            for (unsigned i = start; i < m_trail.size(); ++i)
+                implied.push_back(m_trail[i]);
+        }
+        return result;
+    }
+
     lbool solver::check(unsigned num_lits, literal const* lits) {
         init_reason_unknown();
         pop_to_base_level();
@@ -1496,6 +1579,16 @@ namespace sat {
         if (m_ext && !m_ext->is_pb())
             return l_undef;
 
+        if (m_config.m_parallel_cube && num_lits == 0 && !m_ext && m_config.m_num_threads > 1) {
+            sat::parallel par(*this);
+            par.reserve(m_config.m_num_threads, 1 << 12);
+            lbool r = par.cube_and_conquer(*this, m_config.m_num_threads - 1);
+            par.reset();
+            set_par(nullptr, 0);
+            if (r != l_undef)
+                return r;
+        }
+
 
         int num_extra_solvers = m_config.m_num_threads - 1;
         int num_local_search  = static_cast<int>(m_config.m_local_search_threads);
@@ -2065,6 +2158,18 @@ namespace sat {
     /**
        \brief Apply all simplifications.
     */
+    // The inprocessing cadence is not as fixed as it looks. The expensive
+    // techniques meter themselves against search effort: probing and asymm
+    // branching are charged per propagation (dec() in propagate_core) and a
+    // round runs only when its counter shows the search has amortized the
+    // last one, stopping mid-sweep at a budget and resuming from
+    // m_stopped_at next time. ANF simplification is delay-gated and
+    // lookahead is opt-in. Costs are visible per technique through
+    // collect_statistics and the verbose :cost reports. A utility-driven
+    // bandit over clause-reduction yield would add a second control loop on
+    // top of these counters; yield alone is also a poor signal here, since
+    // probing's value is mostly the implied literals and equivalences it
+    // feeds to scc and the simplifier, not clauses it removes itself.
     void solver::do_simplify() {
         if (!should_simplify()) {
             return;
@@ -3350,6 +3455,19 @@ namespace sat {
        \brief Minimize the number of literals in m_lemma. The main idea is to remove
        literals that are implied by other literals in m_lemma and/or literals
        assigned at level 0.
+
+       Stamp-based shrinking over the binary implication graph is deliberately
+       not part of this path. The stamps in sat::big are computed by a full
+       DFS over the current binary clauses at simplification time (asymm
+       branching, SCC reduction) and are stale the moment search learns or
+       deletes a binary clause, which happens constantly between conflicts;
+       keeping DFS intervals valid under such churn amounts to dynamic tree
+       timestamping, which does not fit the watch-list representation the
+       solver keeps for binaries. The combination below - recursive
+       self-subsumption here plus dynamic subsumption resolution against
+       binary and ternary clauses in dyn_sub_res - covers the
+       binary-implication dominations that matter without a second graph
+       structure to keep consistent.
     */
     bool solver::minimize_lemma() {
         SASSERT(!m_lemma.empty());
@@ -3800,6 +3918,7 @@ namespace sat {
 
     void solver::pop_to_base_level() {
         reset_assumptions();
+        m_batch_asms.reset();
         pop(scope_lvl());
     }
 
@@ -3818,6 +3937,8 @@ namespace sat {
         m_scc.updt_params(p);
         m_rand.set_seed(m_config.m_random_seed);
         m_step_size = m_config.m_step_size_init;
+        m_cls_allocator[0].set_arena_mode(m_config.m_gc_arena);
+        m_cls_allocator[1].set_arena_mode(m_config.m_gc_arena);
         m_drat.updt_config();
         m_fast_glue_avg.set_alpha(m_config.m_fast_glue_avg);
         m_slow_glue_avg.set_alpha(m_config.m_slow_glue_avg);
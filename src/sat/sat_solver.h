@@ -192,6 +192,7 @@ namespace sat {
         no_drat_params          m_no_drat_params;
         scoped_ptr<solver>      m_clone; // for debugging purposes
         literal_vector          m_assumptions;      // additional assumptions during check
+        literal_vector          m_batch_asms;       // cached assumption prefix for propagate_under_assumptions
         literal_set             m_assumption_set;   // set of enabled assumptions
         literal_set             m_ext_assumption_set;   // set of enabled assumptions
         literal_vector          m_core;             // unsat core
@@ -228,6 +229,7 @@ namespace sat {
         friend class ddfw_wrapper;
         friend class prob;
         friend class unit_walk;
+        friend class snapshot;
         friend struct mk_stat;
         friend class elim_vars;
         friend class scoped_detach;
@@ -499,6 +501,14 @@ namespace sat {
         lbool check(unsigned num_lits = 0, literal const* lits = nullptr);
         lbool check(literal_vector const& lits) { return check(lits.size(), lits.data()); }
 
+        // batch unit-propagation under a sequence of assumptions. consecutive calls
+        // reuse the propagation prefix shared with the previous assumption sequence;
+        // only the differing suffix is popped and re-propagated. no search is performed.
+        lbool propagate_under_assumptions(unsigned num_lits, literal const* lits, literal_vector& implied);
+        lbool propagate_under_assumptions(literal_vector const& lits, literal_vector& implied) {
+            return propagate_under_assumptions(lits.size(), lits.data(), implied);
+        }
+
         // retrieve model if solver return sat
         model const & get_model() const { return m_model; }
         bool model_is_current() const { return m_model_is_current; }
@@ -620,6 +630,9 @@ namespace sat {
         void save_psm();
         void gc_half(char const * st_name);
         void gc_dyn_psm();
+        bool memory_over_budget() const;
+        void gc_over_budget();
+        void shrink_watches();
         bool activate_frozen_clause(clause & c);
         unsigned psm(clause const & c) const;
         bool can_delete(clause const & c) const;
@@ -840,6 +853,15 @@ namespace sat {
         clause_vector const& learned() const { return m_learned; }
 
 
+        // -----------------------
+        //
+        // Snapshots (see sat_snapshot.cpp)
+        //
+        // -----------------------
+    public:
+        void save_snapshot(std::ostream & out);
+        bool restore(std::istream & in);
+
         // -----------------------
         //
         // Debugging
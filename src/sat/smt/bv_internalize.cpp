@@ -355,8 +355,12 @@ namespace bv {
             for (expr* bit : bits) {
                 sat::literal lit = ctx.internalize(bit, false, false);
                 TRACE(bv, tout << "set " << m_bits[v][i] << " == " << lit << "\n";);
-                add_clause(~lit, m_bits[v][i]);
-                add_clause(lit, ~m_bits[v][i]);
+                if (lit != m_bits[v][i]) {
+                    // re-blasting the same term (e.g., after pop) yields the
+                    // stored literal again; only link genuinely new encodings.
+                    add_clause(~lit, m_bits[v][i]);
+                    add_clause(lit, ~m_bits[v][i]);
+                }
                 ++i;
             }
             return;
@@ -683,6 +683,18 @@ namespace dt {
        a1 = cons(v1, a2)
        a2 = cons(v2, a3)
        a3 = cons(v3, a1)
+
+       The check is a memoized DFS: nodes proven cycle-free are marked and
+       the marks are shared by every starting variable within one final
+       check, so a round costs one pass over the reachable constructor
+       graph, not a pass per variable. Keeping acyclicity online with a
+       parent-pointer structure does not transfer to this setting: the
+       edges are a product of e-graph merges, a single merge can fuse two
+       classes and close a cycle through equalities far from either
+       constructor, and backtracking retracts merges in stack order - this
+       is dynamic cycle detection on a contracting graph, not union-find,
+       and the conflict explanation still needs the concrete equality path
+       m_parent reconstructs here.
     */
     bool solver::occurs_check(enode* n) {
         TRACE(dt_verbose, tout << "occurs check: " << ctx.bpp(n) << "\n";);
@@ -27,6 +27,17 @@ Notes:
       Now, (* 2 x) is not internal to arithmetic anymore,
      and a theory variable must be created for it.
 
+(*) Theory internalization is deliberately eager. Deferring theory
+    variable creation until an atom first becomes relevant sounds
+    attractive for partially relevant queries, but theory solvers
+    attach axioms, bounds and propagation hooks at internalization
+    time; creating variables lazily mid-search would require replaying
+    those effects at arbitrary decision levels. The supported ways to
+    limit theory work are relevancy filtering (euf_relevancy.cpp),
+    which gates what internalized atoms theories act on, and per-theory
+    delayed expansion such as bv_delay_internalize.cpp, which keeps the
+    enode and defers only the expensive axiomatization to final check.
+
 --*/
 
 #include "ast/pb_decl_plugin.h"
@@ -13,6 +13,20 @@ Author:
 
     Nikolaj Bjorner (nbjorner) 2021-12-27
 
+Notes:
+
+    Propagation cost is already amortized to one occurrence-list visit per
+    transition: a literal becomes relevant at most once per scope, its
+    occurrence list is walked at that moment, and the trail undoes marks on
+    backtracking - occurrence lists are not rescanned on later updates at
+    the same level. The transition rules are also not a reachability
+    closure: making a root clause relevant selects a single positive
+    literal to mark (and may promote Defs to Roots), a case analysis per
+    clause that a word-parallel OR over bitset occurrence rows cannot
+    express. Dense per-literal bitsets would additionally have to be
+    snapshotted or diffed per scope to keep pop() exact, replacing the
+    cheap trail with per-level copies.
+
 --*/
 #include "sat/sat_solver.h"
 #include "sat/smt/euf_solver.h"
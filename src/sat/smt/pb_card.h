@@ -24,6 +24,7 @@ Author:
 namespace pb {
 
     class card : public constraint {
+        unsigned       m_scan_idx = 0; // resume position for the replacement-watch search
         literal        m_lits[0];
     public:
         static size_t get_obj_size(unsigned num_lits) { return sat::constraint_base::obj_size(sizeof(card) + num_lits * sizeof(literal)); }
@@ -39,6 +40,8 @@ namespace pb {
         literal get_lit(unsigned i) const override { return m_lits[i]; }
         void set_lit(unsigned i, literal l) override { m_lits[i] = l; }
         unsigned get_coeff(unsigned i) const override { return 1; }
+        unsigned scan_idx() const { return m_scan_idx; }
+        void set_scan_idx(unsigned i) { m_scan_idx = i; }
         double get_reward(solver_interface const& s, sat::literal_occs_fun& occs) const override;
         std::ostream& display(std::ostream& out) const override;
         std::ostream& display(std::ostream& out, solver_interface const& s, bool values) const override;
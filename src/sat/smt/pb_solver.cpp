@@ -1967,14 +1967,29 @@ namespace pb {
         VERIFY(index <= bound);
         VERIFY(c[index] == alit);
         
-        // find a literal to swap with:
-        for (unsigned i = bound + 1; i < sz; ++i) {
-            literal lit2 = c[i];
-            if (value(lit2) != l_false) {
-                c.swap(index, i);
-                c.watch_literal(*this, lit2);
-                return l_undef;
+        // find a literal to swap with. Resume where the previous search left
+        // off: within a decision level the already scanned prefix stays false,
+        // so restarting at bound + 1 rescans it on every event for long
+        // constraints. The wrap-around keeps the search exact when
+        // backtracking has unassigned literals behind the saved position.
+        if (bound + 1 < sz) {
+            unsigned start = c.scan_idx();
+            if (start <= bound || start >= sz)
+                start = bound + 1;
+            unsigned i = start;
+            do {
+                literal lit2 = c[i];
+                if (value(lit2) != l_false) {
+                    c.set_scan_idx(i + 1);
+                    c.swap(index, i);
+                    c.watch_literal(*this, lit2);
+                    return l_undef;
+                }
+                ++i;
+                if (i == sz)
+                    i = bound + 1;
             }
+            while (i != start);
         }
 
         // conflict
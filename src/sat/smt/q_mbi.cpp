@@ -150,6 +150,16 @@ namespace q {
         return expr_ref(r->get_expr(), m);
     }
 
+    // Violating instances are found by solving, not by scoring candidate
+    // bindings one at a time: specialize() evaluates the quantifier body
+    // under the current model once, producing mbody with the model values
+    // baked in, and an auxiliary solver searches that formula for
+    // counterexample bindings. The per-round cost is therefore one body
+    // evaluation plus solver checks, shared across every binding the round
+    // yields - check_forall_subst pulls up to m_max_cex distinct
+    // counterexamples from one specialization by blocking each projection
+    // before re-checking. A compiled plan over an explicit binding matrix
+    // would reintroduce the enumeration this design exists to avoid.
     lbool mbqi::check_forall(quantifier* q) {
         quantifier* q_flat = m_qs.flatten(q);
         init_solver();
@@ -13,6 +13,19 @@ Author:
 
     Nikolaj Bjorner (nbjorner) 2024-02-21
 
+Notes:
+
+    Exchange between the CDCL side and the SLS thread is already
+    incremental and restricted to the shared vocabulary: sls_smt_plugin
+    ships unit literals, phases for the shared boolean variables, and
+    values for the shared uninterpreted constants, each guarded by a dirty
+    flag and copied under a brief mutex hold - no side re-walks the
+    formula per exchange. The pieces cannot be replaced by a shared egraph
+    snapshot because the two engines run on different ast_managers
+    (managers are thread-confined by design), so every crossing term goes
+    through ast_translation into the sync manager; a congruence snapshot
+    would have to be translated node by node, which is the cost the
+    current shared-constant protocol avoids.
 
 --*/
 
@@ -192,12 +192,20 @@ namespace smt {
         reset_expr_triples();
         m_triple.m_to_instantiate.reset();
         m_triple.m_qhead = 0;
+
+        m_threshold          = m_params.m_dack_threshold;
+        m_factor             = m_params.m_dack_factor;
+        m_round_events       = 0;
+        m_round_instances    = 0;
+        m_round_deleted      = 0;
+        m_last_cg_collisions = m_context.get_cg_table().get_num_collisions();
     }
 
     void dyn_ack_manager::cg_eh(app * n1, app * n2) {
         SASSERT(n1->get_decl() == n2->get_decl());
         SASSERT(n1->get_num_args() == n2->get_num_args());
         SASSERT(n1 != n2);
+        m_round_events++;
         if (m.is_eq(n1)) {
             return;
         }
@@ -224,7 +232,7 @@ namespace smt {
         unsigned num_occs2 = 0;
         SASSERT(m_app_pair2num_occs.find(n1, n2, num_occs2) && num_occs == num_occs2);
 #endif
-        if (num_occs == m_params.m_dack_threshold) {
+        if (num_occs == m_threshold) {
             TRACE(dyn_ack, tout << "found candidate:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) << "\nnum_occs: " << num_occs << "\n";);
             m_to_instantiate.push_back(p);
         }
@@ -234,6 +242,7 @@ namespace smt {
         if (n1 == n2 || r == n1 || r == n2 || m.is_bool(n1)) {
             return;
         }
+        m_round_events++;
         if (n1->get_id() > n2->get_id())
             std::swap(n1,n2);
         TRACE(dyn_ack, 
@@ -261,7 +270,7 @@ namespace smt {
         unsigned num_occs2 = 0;
         SASSERT(m_triple.m_app2num_occs.find(n1, n2, r, num_occs2) && num_occs == num_occs2);
 #endif
-        if (num_occs == m_params.m_dack_threshold) {
+        if (num_occs == m_threshold) {
             TRACE(dyn_ack, tout << "found candidate:\n" << mk_pp(n1, m) << "\n" << mk_pp(n2, m) 
                   << "\n" << mk_pp(r, m) 
                   << "\nnum_occs: " << num_occs << "\n";);
@@ -328,7 +337,7 @@ namespace smt {
             ++it2;
             SASSERT(num_occs > 0);
             m_app_pair2num_occs.insert(a1, a2, num_occs);
-            if (num_occs >= m_params.m_dack_threshold)
+            if (num_occs >= m_threshold)
                 m_to_instantiate.push_back(p);
         }
         m_app_pairs.set_end(it2);
@@ -358,6 +367,7 @@ namespace smt {
             SASSERT(a1 && a2);
             m_instantiated.erase(p);
             m_clause2app_pair.erase(cls);
+            m_round_deleted++;
             SASSERT(!m_app_pair2num_occs.contains(a1, a2));
             return;
         }
@@ -367,6 +377,7 @@ namespace smt {
             SASSERT(a1 && a2 && a3);
             m_triple.m_instantiated.erase(tr);
             m_triple.m_clause2apps.erase(cls);
+            m_round_deleted++;
             SASSERT(!m_triple.m_app2num_occs.contains(a1, a2, a3));
             return;
         }
@@ -377,20 +388,23 @@ namespace smt {
             return;
         m_num_propagations_since_last_gc++;
         if (m_num_propagations_since_last_gc > m_params.m_dack_gc) {
+            adapt_budget();
             gc();
             m_num_propagations_since_last_gc = 0;
         }
-        unsigned max_instances  = static_cast<unsigned>(m_context.get_num_conflicts() * m_params.m_dack_factor);
+        unsigned max_instances  = static_cast<unsigned>(m_context.get_num_conflicts() * m_factor);
         while (m_num_instances < max_instances && m_qhead < m_to_instantiate.size()) {
             auto& [first, second] = m_to_instantiate[m_qhead];
             m_qhead++;
             m_num_instances++;
+            m_round_instances++;
             instantiate(first, second);
         }
         while (m_num_instances < max_instances && m_triple.m_qhead < m_triple.m_to_instantiate.size()) {
             auto& [first, second, third] = m_triple.m_to_instantiate[m_triple.m_qhead];
             m_triple.m_qhead++;
             m_num_instances++;
+            m_round_instances++;
             instantiate(first, second, third);
         }
     }
@@ -563,7 +577,7 @@ namespace smt {
             ++it2;
             SASSERT(num_occs > 0);
             m_triple.m_app2num_occs.insert(a1, a2, a3, num_occs);
-            if (num_occs >= m_params.m_dack_threshold)
+            if (num_occs >= m_threshold)
                 m_triple.m_to_instantiate.push_back(p);
         }
         m_triple.m_apps.set_end(it2);
@@ -574,6 +588,64 @@ namespace smt {
 
 
 
+    /**
+       \brief Retune the occurrence threshold and the per-conflict lemma budget.
+       Invoked once per gc round (every dack.gc propagations).
+
+       The controller uses two signals: the number of hash collisions the
+       congruence table accumulated during the round (congruence pressure), and
+       the turnover of the Ackermann lemmas created so far (lemmas deleted vs.
+       created in the round). High turnover means the clause database is being
+       flooded with lemmas that do not survive, so the trigger is raised and the
+       budget halved. High pressure with low turnover means ackermannization is
+       firing too late, so the trigger is lowered and the budget doubled. Both
+       knobs stay within a factor of four of their configured values.
+    */
+    void dyn_ack_manager::adapt_budget() {
+        if (!m_params.m_dack_adaptive)
+            return;
+        unsigned collisions       = m_context.get_cg_table().get_num_collisions();
+        unsigned delta_collisions = collisions - m_last_cg_collisions;
+        m_last_cg_collisions      = collisions;
+        bool flooded  = m_round_instances > 0 && 2 * m_round_deleted > m_round_instances;
+        bool pressure = delta_collisions > m_params.m_dack_gc || 4 * m_round_events > m_params.m_dack_gc;
+        if (flooded) {
+            if (m_threshold < 4 * m_params.m_dack_threshold) {
+                m_threshold++;
+                m_ctrl_stats.m_num_threshold_incs++;
+            }
+            if (m_factor > m_params.m_dack_factor / 4) {
+                m_factor /= 2;
+                m_ctrl_stats.m_num_budget_decs++;
+            }
+        }
+        else if (pressure) {
+            if (m_threshold > 2) {
+                m_threshold--;
+                m_ctrl_stats.m_num_threshold_decs++;
+            }
+            if (m_factor < 4 * m_params.m_dack_factor) {
+                m_factor *= 2;
+                m_ctrl_stats.m_num_budget_incs++;
+            }
+        }
+        TRACE(dyn_ack, tout << "adapt_budget: collisions: " << delta_collisions << ", events: " << m_round_events
+              << ", created: " << m_round_instances << ", deleted: " << m_round_deleted
+              << " -> threshold: " << m_threshold << ", factor: " << m_factor << "\n";);
+        m_round_events    = 0;
+        m_round_instances = 0;
+        m_round_deleted   = 0;
+    }
+
+    void dyn_ack_manager::collect_statistics(::statistics & st) const {
+        if (!m_params.m_dack_adaptive)
+            return;
+        st.update("dyn ack threshold incs", m_ctrl_stats.m_num_threshold_incs);
+        st.update("dyn ack threshold decs", m_ctrl_stats.m_num_threshold_decs);
+        st.update("dyn ack budget incs", m_ctrl_stats.m_num_budget_incs);
+        st.update("dyn ack budget decs", m_ctrl_stats.m_num_budget_decs);
+    }
+
 #ifdef Z3DEBUG
     bool dyn_ack_manager::check_invariant() const {
         for (auto const& kv : m_clause2app_pair) {
@@ -18,9 +18,11 @@ Revision History:
 --*/
 #pragma once
 
+#include <cstring>
 #include "ast/ast.h"
 #include "params/dyn_ack_params.h"
 #include "util/obj_hashtable.h"
+#include "util/statistics.h"
 #include "util/obj_pair_hashtable.h"
 #include "util/obj_triple_hashtable.h"
 #include "smt/smt_clause.h"
@@ -65,8 +67,33 @@ namespace smt {
             clause2expr_triple                     m_clause2apps;
         };
         _triple                                    m_triple;
-        
 
+        // -----------------------
+        //
+        // Adaptive budget controller (dack.adaptive). The occurrence
+        // threshold and per-conflict lemma budget are retuned at each gc
+        // round based on congruence-table collision pressure and the
+        // turnover of previously created Ackermann lemmas.
+        //
+        // -----------------------
+        unsigned                                   m_threshold = 0;          //!< current occurrence trigger, seeded from dack.threshold
+        double                                     m_factor = 0.0;           //!< current lemma budget factor, seeded from dack.factor
+        unsigned                                   m_round_events = 0;       //!< congruence/equality conflict events in the current round
+        unsigned                                   m_round_instances = 0;    //!< Ackermann lemmas created in the current round
+        unsigned                                   m_round_deleted = 0;      //!< Ackermann lemmas deleted in the current round
+        unsigned                                   m_last_cg_collisions = 0; //!< cg-table collision count at the last adaptation
+
+        struct ctrl_stats {
+            unsigned m_num_threshold_incs;
+            unsigned m_num_threshold_decs;
+            unsigned m_num_budget_incs;
+            unsigned m_num_budget_decs;
+            ctrl_stats() { reset(); }
+            void reset() { memset(this, 0, sizeof(ctrl_stats)); }
+        };
+        ctrl_stats                                 m_ctrl_stats;
+
+        void adapt_budget();
 
         void gc();
         void reset_app_pairs();
@@ -125,6 +152,8 @@ namespace smt {
 
         void reset();
 
+        void collect_statistics(::statistics & st) const;
+
 #ifdef Z3DEBUG
         bool check_invariant() const;
 #endif
@@ -20,37 +20,17 @@ Revision History:
 
 namespace smt {
 
+    static const unsigned INITIAL_CAPACITY = 64;
+
     fingerprint::fingerprint(region & r, void * d, unsigned d_h, unsigned n, enode * const * args):
-        m_data(d), 
+        m_data(d),
         m_data_hash(d_h),
-        m_num_args(n), 
+        m_num_args(n),
         m_args(nullptr) {
         m_args = new (r) enode*[n];
         memcpy(m_args, args, sizeof(enode*) * n);
     }
 
-    bool fingerprint_set::fingerprint_eq_proc::operator()(fingerprint const * f1, fingerprint const * f2) const {
-        if (f1->get_data() != f2->get_data()) 
-            return false;
-        if (f1->get_num_args() != f2->get_num_args())
-            return false;
-        unsigned n = f1->get_num_args();
-        for(unsigned i = 0; i < n; ++i)
-            if (f1->get_arg(i) != f2->get_arg(i))
-                return false;
-        return true;
-    }
-
-    fingerprint * fingerprint_set::mk_dummy(void * data, unsigned data_hash, unsigned num_args, enode * const * args) {
-        m_tmp.reset();
-        m_tmp.append(num_args, args);
-        m_dummy.m_data      = data;
-        m_dummy.m_data_hash = data_hash;
-        m_dummy.m_num_args  = num_args;
-        m_dummy.m_args      = m_tmp.data();
-        return &m_dummy;
-    }
-
     std::ostream& operator<<(std::ostream& out, fingerprint const& f) {
         out << f.get_data_hash() << " " << " num_args " << f.get_num_args() << " ";
         for (enode const * arg : f) {
@@ -60,9 +40,7 @@ namespace smt {
         return out;
     }
 
-    
-    fingerprint * fingerprint_set::insert(void * data, unsigned data_hash, unsigned num_args, enode * const * args) {
-        
+    unsigned fingerprint_set::mk_hash(unsigned data_hash, unsigned num_args, enode * const * args) {
         struct arg_data {
             unsigned data_hash;
             enode* const* args;
@@ -77,57 +55,128 @@ namespace smt {
                 return d.args[i]->hash();
             }
         };
-        arg_data arg_data({ data_hash, args });
+        arg_data d({ data_hash, args });
         khash kh;
         arghash ah;
-        data_hash = get_composite_hash(arg_data, num_args, kh, ah);
+        return get_composite_hash(d, num_args, kh, ah);
+    }
+
+    bool fingerprint_set::eq(fingerprint const * f, void const * data, unsigned num_args, enode * const * args) const {
+        if (f->get_data() != data)
+            return false;
+        if (f->get_num_args() != num_args)
+            return false;
+        for (unsigned i = 0; i < num_args; ++i)
+            if (f->get_arg(i) != args[i])
+                return false;
+        return true;
+    }
+
+    fingerprint * fingerprint_set::find(void const * data, unsigned hash, unsigned num_args, enode * const * args) const {
+        if (m_table.empty())
+            return nullptr;
+        unsigned mask = m_table.size() - 1;
+        unsigned i    = hash & mask;
+        while (true) {
+            cell const & c = m_table[i];
+            if (c.m_index == UINT_MAX)
+                return nullptr;
+            // cells whose index is past the trail are stale, skip them.
+            if (c.m_index < m_fingerprints.size() && c.m_hash == hash) {
+                fingerprint * f = m_fingerprints[c.m_index];
+                if (eq(f, data, num_args, args))
+                    return f;
+            }
+            i = (i + 1) & mask;
+        }
+    }
+
+    void fingerprint_set::insert_cell(unsigned hash, unsigned index) {
+        unsigned mask = m_table.size() - 1;
+        unsigned i    = hash & mask;
+        while (true) {
+            cell & c = m_table[i];
+            if (c.m_index == UINT_MAX) {
+                c.m_hash  = hash;
+                c.m_index = index;
+                m_used++;
+                return;
+            }
+            if (c.m_index >= m_fingerprints.size()) {
+                // reuse a stale cell; the probe chain stays intact since
+                // the cell remains occupied.
+                c.m_hash  = hash;
+                c.m_index = index;
+                return;
+            }
+            i = (i + 1) & mask;
+        }
+    }
+
+    void fingerprint_set::rehash(unsigned capacity) {
+        SASSERT(is_power_of_two(capacity));
+        m_table.reset();
+        m_table.resize(capacity);
+        m_used = 0;
+        for (unsigned i = 0; i < m_fingerprints.size(); ++i)
+            insert_cell(m_fingerprints[i]->get_data_hash(), i);
+    }
 
-        fingerprint * d = mk_dummy(data, data_hash, num_args, args);
-        if (m_set.contains(d)) 
+    fingerprint * fingerprint_set::insert(void * data, unsigned data_hash, unsigned num_args, enode * const * args) {
+        data_hash = mk_hash(data_hash, num_args, args);
+        if (find(data, data_hash, num_args, args))
             return nullptr;
+        m_tmp.reset();
         for (unsigned i = 0; i < num_args; ++i)
-            d->m_args[i] = d->m_args[i]->get_root();
-        if (m_set.contains(d)) {
-            TRACE(fingerprint_bug, tout << "failed: " << *d;);
+            m_tmp.push_back(args[i]->get_root());
+        if (find(data, data_hash, num_args, m_tmp.data())) {
+            TRACE(fingerprint_bug, tout << "failed: " << data_hash << " num_args " << num_args << "\n";);
             return nullptr;
         }
-        TRACE(fingerprint_bug, tout << "inserting @" << m_scopes.size() << " " << *d;);
-        fingerprint * f = new (m_region) fingerprint(m_region, data, data_hash, num_args, d->m_args);
+        if (m_table.empty())
+            rehash(INITIAL_CAPACITY);
+        else if (4 * (m_used + 1) > 3 * m_table.size()) {
+            // grow when the live entries dominate, otherwise just purge the
+            // stale cells accumulated by backtracking.
+            unsigned capacity = m_table.size();
+            if (2 * (m_fingerprints.size() + 1) > capacity)
+                capacity *= 2;
+            rehash(capacity);
+        }
+        fingerprint * f = new (m_region) fingerprint(m_region, data, data_hash, num_args, m_tmp.data());
+        TRACE(fingerprint_bug, tout << "inserting @" << m_scopes.size() << " " << *f;);
         m_fingerprints.push_back(f);
-        m_set.insert(f);
+        insert_cell(data_hash, m_fingerprints.size() - 1);
         return f;
     }
 
     bool fingerprint_set::contains(void * data, unsigned data_hash, unsigned num_args, enode * const * args) {
-        fingerprint * d = mk_dummy(data, data_hash, num_args, args);
-        if (m_set.contains(d)) 
+        data_hash = mk_hash(data_hash, num_args, args);
+        if (find(data, data_hash, num_args, args))
             return true;
+        m_tmp.reset();
         for (unsigned i = 0; i < num_args; ++i)
-            d->m_args[i] = d->m_args[i]->get_root();
-        return m_set.contains(d);
+            m_tmp.push_back(args[i]->get_root());
+        return find(data, data_hash, num_args, m_tmp.data()) != nullptr;
     }
-    
+
     void fingerprint_set::reset() {
-        m_set.reset();
+        m_table.reset();
+        m_used = 0;
         m_fingerprints.reset();
     }
-        
+
     void fingerprint_set::push_scope() {
         m_scopes.push_back(m_fingerprints.size());
     }
-    
+
     void fingerprint_set::pop_scope(unsigned num_scopes) {
         unsigned lvl      = m_scopes.size();
         SASSERT(num_scopes <= lvl);
         unsigned new_lvl  = lvl - num_scopes;
         unsigned old_size = m_scopes[new_lvl];
-        unsigned size     = m_fingerprints.size();
-        if (old_size == 0 && size > 0) 
-            m_set.reset();
-        else {
-            for (unsigned i = old_size; i < size; ++i) 
-                m_set.erase(m_fingerprints[i]);
-        }
+        // the cells of the retracted fingerprints become stale and are
+        // reclaimed lazily, see find and insert_cell.
         m_fingerprints.shrink(old_size);
         m_scopes.shrink(new_lvl);
         TRACE(fingerprint_bug, tout << "pop @" << m_scopes.size() << "\n";);
@@ -135,7 +184,6 @@ namespace smt {
 
     void fingerprint_set::display(std::ostream & out) const {
         out << "fingerprints:\n";
-        SASSERT(m_set.size() == m_fingerprints.size());
         for (fingerprint const * f : m_fingerprints) {
             out << f->get_data() << " " << *f;
         }
@@ -164,5 +212,5 @@ namespace smt {
     }
 #endif
 
-    
+
 }
@@ -30,8 +30,6 @@ namespace smt {
         unsigned      m_num_args = 0;
         enode**       m_args = nullptr;
 
-        friend class fingerprint_set;
-        fingerprint() = default;
     public:
         fingerprint(region & r, void * d, unsigned d_hash, unsigned n, enode * const * args);
         void * get_data() const { return m_data; }
@@ -44,24 +42,34 @@ namespace smt {
         friend std::ostream& operator<<(std::ostream& out, fingerprint const& f);
     };
     
+    /**
+       \brief Set of fingerprints implemented as an open-addressed hash table
+       over the trail of inserted fingerprints. A table cell stores the hash
+       code and the index of a fingerprint in m_fingerprints. Backtracking
+       just truncates the trail: cells whose index is past the truncation
+       point become tombstones that lookups skip, insertions reuse, and the
+       periodic rehash purges. This makes pop_scope constant time instead of
+       erasing the retracted entries one by one.
+    */
     class fingerprint_set {
-        
-        struct fingerprint_hash_proc {
-            unsigned operator()(fingerprint const * f) const {
-                return f->get_data_hash();
-            }
+
+        struct cell {
+            unsigned m_hash  = 0;
+            unsigned m_index = UINT_MAX; //!< index into m_fingerprints, UINT_MAX for a free cell
         };
-        struct fingerprint_eq_proc { bool operator()(fingerprint const * f1, fingerprint const * f2) const; };
-        typedef ptr_hashtable<fingerprint, fingerprint_hash_proc, fingerprint_eq_proc> set;
 
         region &                 m_region;
-        set                      m_set;
+        svector<cell>            m_table;
+        unsigned                 m_used = 0; //!< number of cells that are not free (live or stale)
         ptr_vector<fingerprint>  m_fingerprints;
         unsigned_vector          m_scopes;
         ptr_vector<enode>        m_tmp;
-        fingerprint              m_dummy;
 
-        fingerprint * mk_dummy(void * data, unsigned data_hash, unsigned num_args, enode * const * args);
+        static unsigned mk_hash(unsigned data_hash, unsigned num_args, enode * const * args);
+        bool eq(fingerprint const * f, void const * data, unsigned num_args, enode * const * args) const;
+        fingerprint * find(void const * data, unsigned hash, unsigned num_args, enode * const * args) const;
+        void insert_cell(unsigned hash, unsigned index);
+        void rehash(unsigned capacity);
 
     public:
         fingerprint_set(ast_manager& m, region & r): m_region(r) {}
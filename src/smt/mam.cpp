@@ -19,6 +19,7 @@ Revision History:
 #include <algorithm>
 
 #include "util/pool.h"
+#include "util/map.h"
 #include "util/trail.h"
 #include "util/stopwatch.h"
 #include "ast/ast_pp.h"
@@ -387,6 +388,11 @@ namespace {
         unsigned                   m_num_choices;
         instruction *              m_root;
         enode_vector               m_candidates;
+        region                     m_instr_region; // own storage for instructions when the code-tree cache is enabled
+        quantifier *               m_cache_qa = nullptr;
+        app *                      m_cache_mp = nullptr;
+        unsigned                   m_cache_first_idx = 0;
+        bool                       m_cacheable = true;
 #ifdef Z3DEBUG
         context *                  m_context;
         ptr_vector<app>            m_patterns;
@@ -522,6 +528,42 @@ namespace {
             return m_filter_candidates;
         }
 
+        region & instr_region() {
+            return m_instr_region;
+        }
+
+        /**
+           \brief Record the triple this tree was compiled from, so that the
+           tree can be reused after backtracking. A tree is only cacheable
+           while it contains the code of a single (quantifier, multi-pattern,
+           first-idx) triple and no instruction references an enode.
+        */
+        void set_cache_key(quantifier * qa, app * mp, unsigned first_idx) {
+            m_cache_qa        = qa;
+            m_cache_mp        = mp;
+            m_cache_first_idx = first_idx;
+        }
+
+        void mark_uncacheable() {
+            m_cacheable = false;
+        }
+
+        bool is_cacheable() const {
+            return m_cacheable && m_cache_mp != nullptr;
+        }
+
+        quantifier * cache_qa() const {
+            return m_cache_qa;
+        }
+
+        app * cache_mp() const {
+            return m_cache_mp;
+        }
+
+        unsigned cache_first_idx() const {
+            return m_cache_first_idx;
+        }
+
         const instruction * get_root() const {
             return m_root;
         }
@@ -590,10 +632,16 @@ namespace {
         label_hasher &    m_lbl_hasher;
         trail_stack &     m_trail_stack;
         region &          m_region;
+        bool              m_own_regions; // allocate instructions in per-tree regions so that trees can survive backtracking
+        code_tree *       m_cur_tree = nullptr;
+
+        region & instr_region() {
+            return m_own_regions && m_cur_tree ? m_cur_tree->instr_region() : m_region;
+        }
 
         template<typename OP>
         OP * mk_instr(opcode op, unsigned size) {
-            void * mem = m_region.allocate(size);
+            void * mem = instr_region().allocate(size);
             OP * r = new (mem) OP;
             r->m_opcode = op;
             r->m_next   = nullptr;
@@ -621,20 +669,26 @@ namespace {
         }
 
     public:
-        code_tree_manager(label_hasher & h, trail_stack & s):
+        code_tree_manager(label_hasher & h, trail_stack & s, bool own_regions = false):
             m_lbl_hasher(h),
             m_trail_stack(s),
-            m_region(s.get_region()) {
+            m_region(s.get_region()),
+            m_own_regions(own_regions) {
+        }
+
+        void set_cur_tree(code_tree * t) {
+            m_cur_tree = t;
         }
 
         code_tree * mk_code_tree(func_decl * lbl, unsigned short num_args, bool filter_candidates) {
             code_tree * r = alloc(code_tree,m_lbl_hasher, lbl, num_args, filter_candidates);
+            m_cur_tree    = r;
             r->m_root     = mk_init(num_args);
             return r;
         }
 
         joint2 * mk_joint2(func_decl * f, unsigned pos, unsigned reg) {
-            return new (m_region) joint2(f, pos, reg);
+            return new (instr_region()) joint2(f, pos, reg);
         }
 
         compare * mk_compare(unsigned reg1, unsigned reg2) {
@@ -824,6 +878,7 @@ namespace {
             }
 #endif
             m_tree        = t;
+            m_ct_manager.set_cur_tree(t);
             m_qa          = qa;
             m_mp          = mp;
             m_num_choices = 0;
@@ -930,6 +985,7 @@ namespace {
                     // ground applications are viewed as constants, and eagerly
                     // converted into enodes.
                     enode * e = mk_enode(m_context, m_qa, to_app(p));
+                    m_tree->mark_uncacheable(); // instruction references an enode
                     m_seq.push_back(m_ct_manager.mk_check(reg, e));
                     set_check_mark(reg, NOT_CHECKED); // reset mark, register was fully processed.
                     continue;
@@ -1060,6 +1116,7 @@ namespace {
                 unsigned oreg        = m_tree->m_num_regs;
                 m_tree->m_num_regs  += 1;
                 enode * e = mk_enode(m_context, m_qa, n);
+                m_tree->mark_uncacheable(); // instruction references an enode
                 m_seq.push_back(m_ct_manager.mk_get_enode(oreg, e));
                 return oreg;
             }
@@ -1162,6 +1219,7 @@ namespace {
 
                             if (to_app(curr)->is_ground()) {
                                 enode * e = mk_enode(m_context, m_qa, to_app(curr));
+                                m_tree->mark_uncacheable(); // joint references an enode
                                 joints.push_back(TAG(enode *, e, GROUND_TERM_TAG));
                                 continue;
                             }
@@ -2874,26 +2932,77 @@ namespace {
         compiler &                  m_compiler;
         ptr_vector<code_tree>       m_trees;       // mapping: func_label -> tree
         trail_stack &               m_trail_stack;
+        bool                        m_cache_enabled;
 #ifdef Z3DEBUG
         context *                   m_context;
 #endif
 
+        /**
+           \brief Cache of compiled code trees that survives backtracking.
+           When a tree created in a popped scope holds the code of a single
+           (quantifier, multi-pattern, first-idx) triple, it is recycled here
+           instead of being deallocated, and reinstalled when the same triple
+           is compiled again. This avoids the latency spikes caused by
+           recompiling thousands of patterns after pop on incremental queries.
+        */
+        struct tree_cache_key {
+            quantifier * m_qa = nullptr;
+            app *        m_mp = nullptr;
+            unsigned     m_first_idx = 0;
+            tree_cache_key() = default;
+            tree_cache_key(quantifier * qa, app * mp, unsigned first_idx):
+                m_qa(qa), m_mp(mp), m_first_idx(first_idx) {}
+            unsigned hash() const {
+                return combine_hash(combine_hash(m_qa->get_id(), m_mp->get_id()), m_first_idx);
+            }
+            bool operator==(tree_cache_key const & other) const {
+                return m_qa == other.m_qa && m_mp == other.m_mp && m_first_idx == other.m_first_idx;
+            }
+        };
+        typedef map<tree_cache_key, code_tree *, obj_hash<tree_cache_key>, default_eq<tree_cache_key>> tree_cache;
+        tree_cache                  m_cache;
+
+        void flush_cache() {
+            for (auto const & kv : m_cache) {
+                m.dec_ref(kv.m_key.m_qa);
+                m.dec_ref(kv.m_key.m_mp);
+                dealloc(kv.m_value);
+            }
+            m_cache.reset();
+        }
+
         class mk_tree_trail : public trail {
-            ptr_vector<code_tree> & m_trees;
-            unsigned                m_lbl_id;
+            code_tree_map & m_map;
+            unsigned        m_lbl_id;
         public:
-            mk_tree_trail(ptr_vector<code_tree> & t, unsigned id):m_trees(t), m_lbl_id(id) {}
+            mk_tree_trail(code_tree_map & m, unsigned id):m_map(m), m_lbl_id(id) {}
             void undo() override {
-                dealloc(m_trees[m_lbl_id]);
-                m_trees[m_lbl_id] = nullptr;
+                m_map.recycle(m_lbl_id);
             }
         };
 
+        void recycle(unsigned lbl_id) {
+            code_tree * t = m_trees[lbl_id];
+            m_trees[lbl_id] = nullptr;
+            if (t->is_cacheable()) {
+                tree_cache_key k(t->cache_qa(), t->cache_mp(), t->cache_first_idx());
+                if (!m_cache.contains(k)) {
+                    m.inc_ref(k.m_qa);
+                    m.inc_ref(k.m_mp);
+                    t->reset_candidates();
+                    m_cache.insert(k, t);
+                    return;
+                }
+            }
+            dealloc(t);
+        }
+
     public:
-        code_tree_map(ast_manager & m, compiler & c, trail_stack & s):
+        code_tree_map(ast_manager & m, compiler & c, trail_stack & s, bool cache_enabled = false):
             m(m),
             m_compiler(c),
-            m_trail_stack(s) {
+            m_trail_stack(s),
+            m_cache_enabled(cache_enabled) {
         }
 
 #ifdef Z3DEBUG
@@ -2902,6 +3011,7 @@ namespace {
 
         ~code_tree_map() {
             std::for_each(m_trees.begin(), m_trees.end(), delete_proc<code_tree>());
+            flush_cache();
         }
 
         /**
@@ -2922,10 +3032,25 @@ namespace {
             unsigned lbl_id   = lbl->get_small_id();
             m_trees.reserve(lbl_id+1, nullptr);
             if (m_trees[lbl_id] == nullptr) {
-                m_trees[lbl_id] = m_compiler.mk_tree(qa, mp, first_idx, false);
+                code_tree * t = nullptr;
+                if (m_cache_enabled) {
+                    tree_cache_key k(qa, mp, first_idx);
+                    if (m_cache.find(k, t)) {
+                        m_cache.erase(k);
+                        m.dec_ref(qa);
+                        m.dec_ref(mp);
+                        TRACE(mam, tout << "reusing cached code tree for:\n" << mk_pp(mp, m) << "\n";);
+                    }
+                }
+                if (t == nullptr) {
+                    t = m_compiler.mk_tree(qa, mp, first_idx, false);
+                    if (m_cache_enabled)
+                        t->set_cache_key(qa, mp, first_idx);
+                }
+                m_trees[lbl_id] = t;
                 SASSERT(m_trees[lbl_id]->expected_num_args() == p->get_num_args());
                 DEBUG_CODE(m_trees[lbl_id]->set_context(m_context););
-                m_trail_stack.push(mk_tree_trail(m_trees, lbl_id));
+                m_trail_stack.push(mk_tree_trail(*this, lbl_id));
             }
             else {
                 code_tree * tree = m_trees[lbl_id];
@@ -2934,6 +3059,9 @@ namespace {
                 // We ignore the pattern if it does not have the expected number of arguments.
                 // This is not the ideal solution, but it avoids possible crashes.
                 if (tree->expected_num_args() == p->get_num_args()) {
+                    // the tree now holds more than one compiled pattern and
+                    // can no longer be recycled across backtracking.
+                    tree->mark_uncacheable();
                     m_compiler.insert(tree, qa, mp, first_idx, false);
                 }
             }
@@ -3825,10 +3953,10 @@ namespace {
             m(ctx.get_manager()),
             m_use_filters(use_filters),
             m_trail_stack(),
-            m_ct_manager(m_lbl_hasher, m_trail_stack),
+            m_ct_manager(m_lbl_hasher, m_trail_stack, ctx.get_fparams().m_qi_code_tree_cache),
             m_compiler(ctx, m_ct_manager, m_lbl_hasher, use_filters),
             m_interpreter(ctx, *this, use_filters),
-            m_trees(m, m_compiler, m_trail_stack),
+            m_trees(m, m_compiler, m_trail_stack, ctx.get_fparams().m_qi_code_tree_cache),
             m_region(m_trail_stack.get_region()),
             m_r1(nullptr),
             m_r2(nullptr) {
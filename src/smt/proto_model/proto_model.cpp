@@ -358,6 +358,13 @@ void proto_model::complete_partial_func(func_decl * f, bool use_fresh) {
 
 /**
    \brief Set the (else) field of function interpretations...
+
+   This is already a single batch pass over the declarations, and grouping
+   the missing entries by sort would not save allocations: get_some_value
+   answers from the factory's per-sort value set (falling back to the
+   hash-consed numeral 0), so after the first request every entry of a sort
+   shares one canonical value node. Only use_fresh forces new values, and
+   those must be pairwise distinct, which rules out block allocation too.
 */
 void proto_model::complete_partial_funcs(bool use_fresh) {
     if (m_model_partial)
@@ -40,7 +40,7 @@ namespace smt {
         m_subst(m),
         m_instances(m) {
         init_parser_vars();
-        m_vals.resize(15, 0.0f);
+        m_vals.resize(16, 0.0f);
     }
 
     void qi_queue::setup() {
@@ -64,36 +64,38 @@ namespace smt {
     }
 
     void qi_queue::init_parser_vars() {
-#define COST 14
+#define COST 15
         m_parser.add_var("cost");
-#define MIN_TOP_GENERATION 13
+#define MIN_TOP_GENERATION 14
         m_parser.add_var("min_top_generation");
-#define MAX_TOP_GENERATION 12
+#define MAX_TOP_GENERATION 13
         m_parser.add_var("max_top_generation");
-#define INSTANCES 11
+#define INSTANCES 12
         m_parser.add_var("instances");
-#define SIZE 10
+#define SIZE 11
         m_parser.add_var("size");
-#define DEPTH 9
+#define DEPTH 10
         m_parser.add_var("depth");
-#define GENERATION 8
+#define GENERATION 9
         m_parser.add_var("generation");
-#define QUANT_GENERATION 7
+#define QUANT_GENERATION 8
         m_parser.add_var("quant_generation");
-#define WEIGHT 6
+#define WEIGHT 7
         m_parser.add_var("weight");
-#define VARS 5
+#define VARS 6
         m_parser.add_var("vars");
-#define PATTERN_WIDTH 4
+#define PATTERN_WIDTH 5
         m_parser.add_var("pattern_width");
-#define TOTAL_INSTANCES 3
+#define TOTAL_INSTANCES 4
         m_parser.add_var("total_instances");
-#define SCOPE 2
+#define SCOPE 3
         m_parser.add_var("scope");
-#define NESTED_QUANTIFIERS 1
+#define NESTED_QUANTIFIERS 2
         m_parser.add_var("nested_quantifiers");
-#define CS_FACTOR 0
+#define CS_FACTOR 1
         m_parser.add_var("cs_factor");
+#define UTILITY 0
+        m_parser.add_var("utility");
     }
 
     q::quantifier_stat * qi_queue::set_values(quantifier * q, app * pat, unsigned generation, unsigned min_top_generation, unsigned max_top_generation, float cost) {
@@ -113,6 +115,7 @@ namespace smt {
         m_vals[SCOPE]              = static_cast<float>(m_context.get_scope_level());
         m_vals[NESTED_QUANTIFIERS] = static_cast<float>(stat->get_num_nested_quantifiers());
         m_vals[CS_FACTOR]          = static_cast<float>(stat->get_case_split_factor());
+        m_vals[UTILITY]            = static_cast<float>(stat->get_utility());
         TRACE(qi_queue_detail, for (unsigned i = 0; i < m_vals.size(); ++i) { tout << m_vals[i] << " "; } tout << "\n";);
         return stat;
     }
@@ -136,6 +139,10 @@ namespace smt {
     void qi_queue::insert(fingerprint * f, app * pat, unsigned generation, unsigned min_top_generation, unsigned max_top_generation) {
         quantifier * q         = static_cast<quantifier*>(f->get_data());
         float cost             = get_cost(q, pat, generation, min_top_generation, max_top_generation);
+        if (m_params.m_qi_adaptive)
+            // instances of quantifiers whose recent instantiations participated
+            // in conflicts are promoted; the utility is an EMA in [0, 1].
+            cost = static_cast<float>(cost / (1.0 + m_qm.get_stat(q)->get_utility()));
         TRACE(qi_queue_detail,
               tout << "new instance of " << q->get_qid() << ", weight " << q->get_weight()
               << ", generation: " << generation << ", scope_level: " << m_context.get_scope_level() << ", cost: " << cost << "\n";
@@ -215,6 +222,10 @@ namespace smt {
 
         q::quantifier_stat * stat = m_qm.get_stat(q);
 
+        if (m_params.m_qi_adaptive)
+            // decay the utility; conflicts bump it back up via on_conflict.
+            stat->update_utility(0.0);
+
         if (m_checker.is_sat(q->get_expr(), num_bindings, bindings)) {
             TRACE(checker, tout << "instance already satisfied\n";);
             // we log the "dummy" instantiations separately from "instance"
@@ -505,9 +516,17 @@ namespace smt {
         }
     }
 
+    void qi_queue::on_conflict(quantifier * q) {
+        q::quantifier_stat * stat = m_qm.get_stat(q);
+        stat->inc_num_conflict_uses();
+        stat->update_utility(1.0);
+        m_stats.m_num_conflict_bumps++;
+    }
+
     void qi_queue::collect_statistics(::statistics & st) const {
         st.update("quant instantiations", m_stats.m_num_instances);
         st.update("lazy quant instantiations", m_stats.m_num_lazy_instances);
+        st.update("quant conflict bumps", m_stats.m_num_conflict_bumps);
         st.update("missed quant instantiations", m_delayed_entries.size());
         float min, max;
         get_min_max_costs(min, max);
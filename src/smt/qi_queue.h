@@ -34,7 +34,7 @@ namespace smt {
     class context;
 
     struct qi_queue_stats {
-        unsigned m_num_instances, m_num_lazy_instances;
+        unsigned m_num_instances, m_num_lazy_instances, m_num_conflict_bumps;
         void reset() { memset(this, 0, sizeof(qi_queue_stats)); }
         qi_queue_stats() { reset(); }
     };
@@ -90,6 +90,11 @@ namespace smt {
         void insert(fingerprint * f, app * pat, unsigned generation, unsigned min_top_generation, unsigned max_top_generation);
         void instantiate();
         bool has_work() const { return !m_new_entries.empty(); }
+        /**
+           \brief An instance of q participated in a conflict: bump the
+           utility EMA used by the adaptive cost model (qi.adaptive).
+        */
+        void on_conflict(quantifier * q);
         void init_search_eh();
         bool final_check_eh();
         void push_scope();
@@ -14,6 +14,18 @@ Author:
     Thai Minh Trinh 2017
     Nikolaj Bjorner (nbjorner) 2020-4-16
 
+Notes:
+
+    Queries are index lookups already: entries are keyed by the canonical
+    roots of the two length classes in a pair-hash map, so find() costs one
+    probe regardless of how many equalities are tracked. The table records
+    exactly the offsets the e-graph exposes as x - y = val patterns and is
+    repopulated from the congruence closure per propagation level; chains
+    of offsets between length terms are closed by the arithmetic core when
+    the corresponding difference terms exist, not by this container, which
+    keeps it a cache over asserted facts rather than a deduction engine
+    with its own justification tracking.
+
 --*/
 #pragma once
 
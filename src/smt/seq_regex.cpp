@@ -31,7 +31,13 @@ namespace smt {
         ctx(th.get_context()),
         m(th.get_manager()),
         m_state_to_expr(m),
-        m_state_graph(state_graph::state_pp(this, pp_state)) { }
+        m_state_graph(state_graph::state_pp(this, pp_state)),
+        m_pinned(m) { }
+
+    seq_regex::~seq_regex() {
+        for (auto const& [r, targets] : m_deriv_targets)
+            dealloc(targets);
+    }
 
     seq_util& seq_regex::u() { return th.m_util; }
     class seq_util::rex& seq_regex::re() { return th.m_util.re; }
@@ -453,10 +459,18 @@ namespace smt {
     expr_ref seq_regex::is_nullable_wrapper(expr* r) {
         STRACE(seq_regex, tout << "nullable: " << mk_pp(r, m) << std::endl;);
 
+        expr* cached = nullptr;
+        if (m_nullable_cache.find(r, cached))
+            return expr_ref(cached, m);
+
         expr_ref result = seq_rw().is_nullable(r);
         //TODO: rewrite seems unnecessary here
         rewrite(result);
 
+        m_pinned.push_back(r);
+        m_pinned.push_back(result);
+        m_nullable_cache.insert(r, result);
+
         STRACE(seq_regex, tout << "nullable result: " << mk_pp(result, m) << std::endl;);
         STRACE(seq_regex_brief, tout << "n(" << state_str(r) << ")="
                                        << mk_pp(result, m) << " ";);
@@ -792,12 +806,21 @@ namespace smt {
         would then be misjudged as a non-empty residual.
     */
     void seq_regex::get_derivative_targets(expr* r, expr_ref_vector& targets) {
+        expr_ref_vector* cached = nullptr;
+        if (m_deriv_targets.find(r, cached)) {
+            targets.append(*cached);
+            return;
+        }
         expr_ref_pair_vector cofactors(m);
         seq_rw().brz_derivative_cofactors(r, cofactors);
+        cached = alloc(expr_ref_vector, m);
         for (auto const& [c, t] : cofactors) {
             if (!re().is_empty(t))
-                targets.push_back(t);
+                cached->push_back(t);
         }
+        targets.append(*cached);
+        m_pinned.push_back(r);
+        m_deriv_targets.insert(r, cached);
     }
 
     /*
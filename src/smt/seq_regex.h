@@ -126,6 +126,20 @@ namespace smt {
         // Update the graph
         bool update_state_graph(expr* r);
 
+        /*
+            Compiled-transition cache: maps a regex state to the reachable
+            target states of its symbolic derivative (the cofactor leaves).
+            Enumerating the cofactors walks the full ITE-tree of the
+            derivative, so the result is memoized per regex.  States are
+            canonical expressions and their transitions never change, so
+            entries stay valid across backtracking and across check() calls.
+        */
+        obj_map<expr, expr_ref_vector*> m_deriv_targets;
+        // Nullable results, cached above the two separately-caching
+        // rewriters used by is_nullable_wrapper.
+        obj_map<expr, expr*>           m_nullable_cache;
+        expr_ref_vector                m_pinned;
+
         // Printing expressions for seq_regex_brief
         std::string state_str(expr* e);
         std::string expr_id_str(expr* e);
@@ -193,6 +207,8 @@ namespace smt {
 
         seq_regex(theory_seq& th);
 
+        ~seq_regex();
+
         void push_scope() {}
         void pop_scope(unsigned num_scopes) {}
         bool can_propagate() const { return false; }
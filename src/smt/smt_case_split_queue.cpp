@@ -276,6 +276,218 @@ namespace {
         }
     };
 
+    /**
+       \brief Case split queue based on activity, keeping (activity, variable)
+       pairs packed in a quad-ary heap. Each node is 16 bytes, so the four
+       children of a node share a single 64-byte cache line and comparisons
+       read the keys inline instead of chasing the global activity array.
+       When the context rescales activities the packed keys are rescaled in
+       one pass without reordering the heap.
+    */
+    class pact_case_split_queue : public case_split_queue {
+        struct node {
+            double   m_key;
+            bool_var m_var;
+        };
+        static_assert(sizeof(node) == 16, "four heap nodes per cache line");
+
+        context &        m_context;
+        smt_params &     m_params;
+        svector<node>    m_nodes;
+        unsigned_vector  m_var2pos; //!< UINT_MAX if the variable is not in the heap
+
+        // The root is at index 0 and the children of i are 4i+4 .. 4i+7, so
+        // every sibling group starts at a multiple of 64 bytes; the slots
+        // 1 .. 3 are padding and never referenced.
+        static unsigned parent(unsigned i) { return (i >> 2) - 1; }
+        static unsigned child(unsigned i) { return 4 * i + 4; }
+
+        bool contains(bool_var v) const {
+            return v < m_var2pos.size() && m_var2pos[v] != UINT_MAX;
+        }
+
+        bool empty() const {
+            return m_nodes.empty();
+        }
+
+        void set(unsigned i, node const & n) {
+            m_nodes[i]         = n;
+            m_var2pos[n.m_var] = i;
+        }
+
+        void sift_up(unsigned i, node const & n) {
+            while (i != 0) {
+                unsigned p = parent(i);
+                if (m_nodes[p].m_key >= n.m_key)
+                    break;
+                set(i, m_nodes[p]);
+                i = p;
+            }
+            set(i, n);
+        }
+
+        void sift_down(unsigned i, node const & n) {
+            unsigned sz = m_nodes.size();
+            while (true) {
+                unsigned c = child(i);
+                if (c >= sz)
+                    break;
+                unsigned end  = std::min(c + 4, sz);
+                unsigned best = c;
+                for (unsigned j = c + 1; j < end; ++j)
+                    if (m_nodes[j].m_key > m_nodes[best].m_key)
+                        best = j;
+                if (n.m_key >= m_nodes[best].m_key)
+                    break;
+                set(i, m_nodes[best]);
+                i = best;
+            }
+            set(i, n);
+        }
+
+        void insert(bool_var v) {
+            SASSERT(!contains(v));
+            node n = { m_context.get_activity(v), v };
+            unsigned pos;
+            if (m_nodes.empty()) {
+                m_nodes.push_back(n);
+                pos = 0;
+            }
+            else {
+                if (m_nodes.size() == 1) {
+                    node r = m_nodes[0];
+                    m_nodes.resize(4, r); // slots 1 .. 3 are padding
+                }
+                m_nodes.push_back(n);
+                pos = m_nodes.size() - 1;
+            }
+            sift_up(pos, n);
+        }
+
+        void erase_at(unsigned pos) {
+            node last = m_nodes.back();
+            m_nodes.pop_back();
+            if (m_nodes.size() == 4)
+                m_nodes.shrink(1);
+            if (pos >= m_nodes.size())
+                return; // the erased node was the last one
+            if (pos != 0 && last.m_key > m_nodes[parent(pos)].m_key)
+                sift_up(pos, last);
+            else
+                sift_down(pos, last);
+        }
+
+        void erase(bool_var v) {
+            SASSERT(contains(v));
+            unsigned pos = m_var2pos[v];
+            m_var2pos[v] = UINT_MAX;
+            erase_at(pos);
+        }
+
+        bool_var erase_min() {
+            SASSERT(!empty());
+            bool_var v   = m_nodes[0].m_var;
+            m_var2pos[v] = UINT_MAX;
+            erase_at(0);
+            return v;
+        }
+
+    public:
+        pact_case_split_queue(context & ctx, smt_params & p):
+            m_context(ctx),
+            m_params(p) {
+        }
+
+        void activity_increased_eh(bool_var v) override {
+            if (contains(v)) {
+                node n = { m_context.get_activity(v), v };
+                sift_up(m_var2pos[v], n);
+            }
+        }
+
+        void activity_decreased_eh(bool_var v) override {
+            if (contains(v)) {
+                node n = { m_context.get_activity(v), v };
+                sift_down(m_var2pos[v], n);
+            }
+        }
+
+        void activity_rescaled_eh(double scale) override {
+            for (node & n : m_nodes)
+                n.m_key *= scale;
+        }
+
+        void mk_var_eh(bool_var v) override {
+            m_var2pos.reserve(v + 1, UINT_MAX);
+            SASSERT(!contains(v));
+            insert(v);
+        }
+
+        void del_var_eh(bool_var v) override {
+            if (contains(v))
+                erase(v);
+        }
+
+        void unassign_var_eh(bool_var v) override {
+            // the activity may have been bumped while the variable was
+            // assigned, insert reads the current value.
+            if (!contains(v))
+                insert(v);
+        }
+
+        void relevant_eh(expr * n) override {}
+
+        void init_search_eh() override {}
+
+        void end_search_eh() override {}
+
+        void reset() override {
+            m_nodes.reset();
+            m_var2pos.reset();
+        }
+
+        void push_scope() override {}
+
+        void pop_scope(unsigned num_scopes) override {}
+
+        void next_case_split(bool_var & next, lbool & phase) override {
+            phase = l_undef;
+
+            if (m_context.get_random_value() < static_cast<int>(m_params.m_random_var_freq * random_gen::max_value())) {
+                next = m_context.get_random_value() % m_context.get_num_b_internalized();
+                TRACE(random_split, tout << "next: " << next << " get_assignment(next): " << m_context.get_assignment(next) << "\n";);
+                if (m_context.get_assignment(next) == l_undef)
+                    return;
+            }
+
+            while (!empty()) {
+                next = erase_min();
+                if (m_context.get_assignment(next) == l_undef)
+                    return;
+            }
+
+            next = null_bool_var;
+        }
+
+        void display(std::ostream & out) override {
+            bool first = true;
+            for (unsigned i = 0; i < m_nodes.size(); ++i) {
+                if (1 <= i && i <= 3)
+                    continue; // padding
+                bool_var v = m_nodes[i].m_var;
+                if (m_context.get_assignment(v) == l_undef) {
+                    if (first) {
+                        out << "remaining case-splits:\n";
+                        first = false;
+                    }
+                    out << "#" << m_context.bool_var2expr(v)->get_id() << " ";
+                }
+            }
+            if (!first)
+                out << "\n";
+        }
+    };
+
     static bool has_child_assigned_to(context & ctx, app * parent, lbool val, expr * & undef_child, unsigned order) {
         ptr_vector<expr> undef_children;
         bool found_undef  = false;
@@ -1271,6 +1483,8 @@ namespace smt {
             return alloc(rel_goal_case_split_queue, ctx, p);
         case CS_ACTIVITY_THEORY_AWARE_BRANCHING:
             return alloc(theory_aware_branching_queue, ctx, p);
+        case CS_ACTIVITY_PACKED:
+            return alloc(pact_case_split_queue, ctx, p);
         default:
             return alloc(act_case_split_queue, ctx, p);
         }
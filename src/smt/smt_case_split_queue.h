@@ -32,6 +32,8 @@ namespace smt {
     public:
         virtual void activity_increased_eh(bool_var v) = 0;
         virtual void activity_decreased_eh(bool_var v) = 0;
+        //!< all activities were multiplied by scale; queues that cache activities rescale them here.
+        virtual void activity_rescaled_eh(double scale) {}
         virtual void mk_var_eh(bool_var v) = 0;
         virtual void del_var_eh(bool_var v) = 0;
         virtual void assign_lit_eh(literal l) {}
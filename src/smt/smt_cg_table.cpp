@@ -146,6 +146,27 @@ namespace smt {
         m_func_decl2id.reset();
     }
 
+    unsigned cg_table::get_num_collisions() const {
+        unsigned r = 0;
+        for (void* t : m_tables) {
+            switch (GET_TAG(t)) {
+            case UNARY:
+                r += UNTAG(unary_table*, t)->collisions();
+                break;
+            case BINARY:
+                r += UNTAG(binary_table*, t)->collisions();
+                break;
+            case BINARY_COMM:
+                r += UNTAG(comm_table*, t)->collisions();
+                break;
+            case NARY:
+                r += UNTAG(table*, t)->collisions();
+                break;
+            }
+        }
+        return r;
+    }
+
     void cg_table::display(std::ostream & out) const {
         for (auto const& kv : m_func_decl2id) {
             void * t = m_tables[kv.m_value];
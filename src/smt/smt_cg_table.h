@@ -201,6 +201,13 @@ namespace smt {
 
         void reset();
 
+        /**
+           \brief Return the total number of hash collisions over all
+           per-func-decl tables. Used as a congruence-pressure signal by
+           the dynamic ackermannization controller.
+        */
+        unsigned get_num_collisions() const;
+
         void display(std::ostream & out) const;
 
         void display_binary(std::ostream& out, void* t) const;
@@ -221,7 +221,11 @@ namespace smt {
             default:
                 UNREACHABLE();
             }
-            out.flush();
+            // A flush per record dominates the cost of logging on large
+            // traces. Flush periodically; the stream is also flushed when
+            // the log is closed.
+            if (0 == (++m_num_log_records & 0x3FF))
+                out.flush();
         }
     }
 
@@ -63,6 +63,7 @@ namespace smt {
         void*                           m_on_clause_ctx = nullptr;
         ast_pp_util                     m_pp;
         scoped_ptr<std::ofstream>       m_pp_out;
+        unsigned                        m_num_log_records = 0;
         proof_ref m_assumption, m_rup, m_del, m_smt;
 
         void init_pp_out();
@@ -15,6 +15,20 @@ Author:
 
 Revision History:
 
+Notes:
+
+    When m_manager.proofs_enabled(), lemma proofs are materialized eagerly
+    during resolution. This stays eager because justifications are
+    transient: the antecedent structure a deferred reconstruction would
+    need lives in the justification objects and the trail, both of which
+    are recycled on backtracking and clause deletion, so a compact trace
+    would have to pin them all anyway. Certification flows that only
+    inspect the final argument should use the clause proof trail instead
+    of AST proofs: solver.proof.log streams per-clause inferences to a
+    file with online checking (solver.proof.check), and solver.proof.trim
+    reduces the log to the clauses the final proof actually uses - that
+    path never builds proof terms during search.
+
 --*/
 
 #include "ast/ast_pp.h"
@@ -184,6 +198,18 @@ namespace smt {
 
        \remark This method does not reset the vectors m_antecedents, m_todo_js, m_todo_eqs, nor reset the
        marks in the justification objects.
+
+       \remark The marks implement memoization *within* a conflict: a justification or
+       equality reached through several antecedent chains is expanded only once, and
+       minimization (see process_justification_for_minimization) reuses the expansions
+       performed during resolution by passing a non-zero old_js_qhead to
+       unmark_justifications. The memoization is deliberately not carried across
+       conflicts: a lemma must be asserting with respect to the *current* trail, so a
+       core cached from an earlier, similar conflict cannot be used in place of
+       resolution -- it neither determines the backjump level nor guarantees
+       propagation of the FUIP after backtracking. Recurring conflicts are instead
+       amortized through the learned lemma itself, which turns the re-derivation into
+       unit propagation.
     */
     void conflict_resolution::justification2literals_core(justification * js, literal_vector & result) {
         SASSERT(m_todo_js_qhead <= m_todo_js.size());
@@ -317,6 +343,14 @@ namespace smt {
               m_ctx.display_literal(tout, antecedent);
               m_ctx.display_detailed_literal(tout << " ", antecedent) << "\n";);
         
+        if (!m_ctx.is_marked(var)) {
+            // Quantifier literals are typically assigned at the base level,
+            // so record their participation before the base-level filter.
+            expr * n0 = m_ctx.bool_var2expr(var);
+            if (n0 && is_quantifier(n0))
+                m_ctx.get_qmanager()->on_conflict(to_quantifier(n0));
+        }
+
         if (!m_ctx.is_marked(var) && lvl > m_ctx.get_base_level()) {
             m_ctx.set_mark(var);
             m_ctx.inc_bvar_activity(var);
@@ -1814,7 +1814,9 @@ namespace smt {
      */
     bool context::propagate() {
         TRACE(propagate, tout << "propagating... " << m_qhead << ":" << m_assigned_literals.size() << "\n");
-        
+
+        flush_reinit_clauses();
+
         while (true) {
             if (inconsistent())
                 return false;
@@ -1889,6 +1891,7 @@ namespace smt {
         for (; it != end; ++it)
             *it *= INV_ACTIVITY_LIMIT;
         m_bvar_inc *= INV_ACTIVITY_LIMIT;
+        m_case_split_queue->activity_rescaled_eh(INV_ACTIVITY_LIMIT);
     }
 
     /**
@@ -2049,6 +2052,8 @@ namespace smt {
     */
     void context::push_scope() {
 
+        flush_reinit_clauses();
+
         if (m.has_trace_stream() && !m_is_auxiliary)
             m.trace_stream() << "[push] " << m_scope_lvl << "\n";
 
@@ -2492,6 +2497,55 @@ namespace smt {
         TRACE(reinit_clauses_bug, display_watch_lists(tout););
     }
 
+    /**
+       \brief Try to postpone reinit_clauses for a pop that lands at the base
+       level. On deep push/pop stacks eager reinitialization dominates pop
+       latency, and the work is only needed before the solver propagates or
+       pushes again (see flush_reinit_clauses). Return true if reinitialization
+       was (or remains) deferred.
+
+       Watch and occurrence removal at flush time must only consider variables
+       that stayed alive through every deferred pop, so the smallest number of
+       live variables is tracked in m_reinit_num_bool_vars. Variables created
+       after a deferred pop reuse ids of deleted ones, but they are >= this
+       bound and are therefore not touched.
+    */
+    bool context::defer_reinit_clauses(unsigned num_scopes, unsigned num_bool_vars) {
+        if (m_reinit_deferred && num_bool_vars < m_reinit_num_bool_vars)
+            m_reinit_num_bool_vars = num_bool_vars;
+        if (m_clauses_to_reinit.empty())
+            return m_reinit_deferred;
+        unsigned lim = m_scope_lvl + num_scopes;
+        if (m_clauses_to_reinit.size() <= lim)
+            lim = m_clauses_to_reinit.size() - 1;
+        unsigned num_deferred = 0;
+        for (unsigned i = m_scope_lvl + 1; i <= lim; ++i)
+            num_deferred += m_clauses_to_reinit[i].size();
+        if (num_deferred == 0)
+            return m_reinit_deferred;
+        if (!m_reinit_deferred) {
+            m_reinit_deferred      = true;
+            m_reinit_num_bool_vars = num_bool_vars;
+        }
+        m_stats.m_num_deferred_reinits += num_deferred;
+        return true;
+    }
+
+    /**
+       \brief Process, in a single pass, all clause reinitializations deferred
+       by pop_scope. Invoked before the solver pushes a new scope or
+       propagates.
+    */
+    void context::flush_reinit_clauses() {
+        if (!m_reinit_deferred)
+            return;
+        m_reinit_deferred = false;
+        // all pending levels are processed at once; reinit_clauses caps the
+        // range at the size of m_clauses_to_reinit.
+        reinit_clauses(m_clauses_to_reinit.size(), m_reinit_num_bool_vars);
+        reset_cache_generation();
+    }
+
     void context::reassert_units(unsigned units_to_reassert_lim) {
         unsigned i  = units_to_reassert_lim;
         unsigned sz = m_units_to_reassert.size();
@@ -2518,7 +2572,7 @@ namespace smt {
 
        \warning This method will not invoke reset_cache_generation.
     */
-    unsigned context::pop_scope_core(unsigned num_scopes) {
+    unsigned context::pop_scope_core(unsigned num_scopes, bool defer_reinit) {
         unsigned units_to_reassert_lim = 0;
 
         try {
@@ -2600,7 +2654,11 @@ namespace smt {
 
         unsigned num_bool_vars = get_num_bool_vars();
         // any variable >= num_bool_vars was deleted during backtracking.
-        reinit_clauses(num_scopes, num_bool_vars);
+        if (defer_reinit && m_scope_lvl == m_base_lvl && defer_reinit_clauses(num_scopes, num_bool_vars)) {
+            // lemma reinitialization was postponed, see flush_reinit_clauses.
+        }
+        else
+            reinit_clauses(num_scopes, num_bool_vars);
         reassert_units(units_to_reassert_lim);
         TRACE(pop_scope_detail, tout << "end of pop_scope: \n"; display(tout););
         CASSERT("context", check_invariant());
@@ -2608,8 +2666,11 @@ namespace smt {
     }
 
     void context::pop_scope(unsigned num_scopes) {
-        pop_scope_core(num_scopes);
-        reset_cache_generation();
+        pop_scope_core(num_scopes, true);
+        // when reinitialization was deferred, the cached generations are
+        // still needed by flush_reinit_clauses, which resets them itself.
+        if (!m_reinit_deferred)
+            reset_cache_generation();
     }
 
     void context::pop_to_base_lvl() {
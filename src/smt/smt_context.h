@@ -90,6 +90,7 @@ namespace smt {
         friend class model_generator;
         friend class lookahead;
         friend class parallel;
+        friend class model_enumerator;
         friend class kernel;
     public:
         statistics                  m_stats;
@@ -207,6 +208,8 @@ namespace smt {
         clause_vector               m_aux_clauses;
         clause_vector               m_lemmas;
         vector<clause_vector>       m_clauses_to_reinit;
+        bool                        m_reinit_deferred = false; //!< true if clause reinitialization was postponed by pop_scope (see flush_reinit_clauses)
+        unsigned                    m_reinit_num_bool_vars = 0; //!< smallest number of live boolean variables over the deferred pops
         vector<replay_unit>         m_units_to_reassert;
         literal_vector              m_assigned_literals;
         typedef std::pair<clause*, literal_vector> tmp_clause;
@@ -320,6 +323,14 @@ namespace smt {
             return m_region;
         }
 
+        quantifier_manager * get_qmanager() {
+            return m_qmanager.get();
+        }
+
+        cg_table const & get_cg_table() const {
+            return m_cg_table;
+        }
+
         bool relevancy() const {
             return relevancy_lvl() > 0;
         }
@@ -722,7 +733,7 @@ namespace smt {
 
         void push_scope();
 
-        unsigned pop_scope_core(unsigned num_scopes);
+        unsigned pop_scope_core(unsigned num_scopes, bool defer_reinit = false);
 
         void pop_scope(unsigned num_scopes);
 
@@ -754,6 +765,10 @@ namespace smt {
 
         void reinit_clauses(unsigned num_scopes, unsigned num_bool_vars);
 
+        bool defer_reinit_clauses(unsigned num_scopes, unsigned num_bool_vars);
+
+        void flush_reinit_clauses();
+
         void reassert_units(unsigned units_to_reassert_lim);
 
     public:
@@ -882,6 +897,8 @@ namespace smt {
 
         bool internalize_theory_term(app * n);
 
+        bool internalize_theory_term_lazy(app * n);
+
         void internalize_uninterpreted(app * n);
 
         friend class mk_bool_var_trail;
@@ -42,8 +42,10 @@ namespace smt {
     }
 
     bool context::check_clauses(clause_vector const & v) const {
-        for (clause* cls : v) 
-            if (!cls->deleted())
+        for (clause* cls : v)
+            // clauses with deferred reinitialization may watch deleted variables
+            // until flush_reinit_clauses runs.
+            if (!cls->deleted() && !(m_reinit_deferred && cls->in_reinit_stack()))
                 check_clause(cls);
         return true;
     }
@@ -417,7 +417,9 @@ namespace smt {
         st.update("mk clause", m_stats.m_num_mk_clause);
         st.update("mk clause binary", m_stats.m_num_mk_bin_clause);        
         st.update("del clause", m_stats.m_num_del_clause);
+        st.update("deferred clause reinits", m_stats.m_num_deferred_reinits);
         st.update("dyn ack", m_stats.m_num_dyn_ack);
+        m_dyn_ack_manager.collect_statistics(st);
         st.update("interface eqs", m_stats.m_num_interface_eqs);
         st.update("max generation", m_stats.m_max_generation);
         st.update("minimized lits", m_stats.m_num_minimized_lits);
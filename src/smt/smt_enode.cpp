@@ -35,7 +35,6 @@ namespace smt {
         n->m_next             = n;
         n->m_cg               = nullptr;
         n->m_class_size       = 1;
-        n->m_generation       = generation;
         n->m_func_decl_id     = UINT_MAX;
         n->m_mark             = false;
         n->m_mark2            = false;
@@ -46,10 +45,11 @@ namespace smt {
         n->m_bool             = m.is_bool(owner);
         n->m_merge_tf         = merge_tf;
         n->m_cgc_enabled      = cgc_enabled;
+        n->m_is_shared        = 2;
+        n->m_generation       = generation;
         n->m_iscope_lvl       = iscope_lvl;
+        n->m_proof_is_logged  = false;
         n->m_lbl_hash         = -1;
-        n->m_proof_is_logged = false;
-        n->m_is_shared        = 2;
         unsigned num_args     = n->get_num_args();
         for (unsigned i = 0; i < num_args; ++i) {            
             enode * arg  = app2enode[to_app(owner)->get_arg(i)->get_id()];
@@ -59,17 +59,23 @@ namespace smt {
        equality propagation, and the theory central bus of equalities.
     */
     class enode {
+        // -----------------------------------
+        //
+        // Hot fields: everything read by the congruence-closure inner loops
+        // (cg_table hashing/comparison and add_eq/merge) is grouped at the
+        // beginning of the object so those loops touch a single cache line
+        // per node. Rarely accessed fields are moved to the cold tail below.
+        //
+        // -----------------------------------
         expr  *             m_owner;    //!< The application that 'owns' this enode.
         enode *             m_root;     //!< Representative of the equivalence class
         enode *             m_next;     //!< Next element in the equivalence class.
-        enode *             m_cg;       
+        enode *             m_cg;
         unsigned            m_class_size;    //!< Size of the equivalence class if the enode is the root.
-        unsigned            m_generation;    //!< Cached generation of the congruence class. Valid when is_cgr(), or when the enode does not use the cg_table (constants/leaves/true-eq nodes), where it directly stores the enode's generation.
-
         unsigned            m_func_decl_id; //!< Id generated by the congruence table for fast indexing.
 
-        unsigned            m_mark:1;        //!< Multi-purpose auxiliary mark. 
-        unsigned            m_mark2:1;       //!< Multi-purpose auxiliary mark. 
+        unsigned            m_mark:1;        //!< Multi-purpose auxiliary mark.
+        unsigned            m_mark2:1;       //!< Multi-purpose auxiliary mark.
         unsigned            m_interpreted:1; //!< True if the node is an interpreted constant.
         unsigned            m_suppress_args:1;  //!< True if the arguments of m_owner should not be accessed by this enode.
         unsigned            m_eq:1;             //!< True if it is an equality
@@ -78,9 +84,6 @@ namespace smt {
         unsigned            m_merge_tf:1;       //!< True if the enode should be merged with true/false when the associated boolean variable is assigned.
         unsigned            m_cgc_enabled:1;    //!< True if congruence closure is enabled for this enode.
         unsigned            m_is_shared:2;      //!< 0 - not shared, 1 - shared, 2 - invalid state
-        unsigned            m_iscope_lvl;       //!< When the enode was internalized
-        bool                m_proof_is_logged;  //!< Indicates that the proof for the enode being equal to its root is in the log.
-        signed char         m_lbl_hash;         //!< It is different from -1, if enode is used in a pattern
         /*
           The following property is valid for m_parents
           
@@ -98,7 +101,18 @@ namespace smt {
         */
         enode_vector        m_parents;          //!< Parent enodes of the equivalence class.
         id_var_list<>       m_th_var_list;      //!< List of theories that 'care' about this enode.
+
+        // -----------------------------------
+        //
+        // Cold fields: justification/proof data and pattern/quantifier
+        // bookkeeping, accessed outside the congruence-closure hot path.
+        //
+        // -----------------------------------
         trans_justification m_trans;            //!< A justification for the enode being equal to its root.
+        unsigned            m_generation;       //!< Cached generation of the congruence class. Valid when is_cgr(), or when the enode does not use the cg_table (constants/leaves/true-eq nodes), where it directly stores the enode's generation.
+        unsigned            m_iscope_lvl;       //!< When the enode was internalized
+        bool                m_proof_is_logged;  //!< Indicates that the proof for the enode being equal to its root is in the log.
+        signed char         m_lbl_hash;         //!< It is different from -1, if enode is used in a pattern
         approx_set          m_lbls;
         approx_set          m_plbls;
         enode *             m_args[0];          //!< Cached args
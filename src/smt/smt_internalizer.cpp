@@ -898,6 +898,9 @@ namespace smt {
             internalize_ite_term(n);
             return; // it is not necessary to apply sort constraint
         }
+        else if (internalize_theory_term_lazy(n)) {
+            // enode was created, theory internalization is delayed until n becomes relevant
+        }
         else if (internalize_theory_term(n)) {
             // skip
         }
@@ -964,6 +967,37 @@ namespace smt {
         return true;
     }
 
+    /**
+       \brief Internalize a theory term without invoking its theory plugin.
+       The enode is created eagerly, so congruence closure sees the term,
+       but theory variables and theory axioms are only created when the
+       relevancy engine marks the term as relevant. The handler installed
+       below re-enters internalize_term, which dispatches to
+       th->internalize_term for enodes that are not attached to a theory
+       variable yet. Return false if lazy internalization does not apply.
+    */
+    bool context::internalize_theory_term_lazy(app * n) {
+        if (!m_fparams.m_lazy_internalization || relevancy_lvl() < 2)
+            return false;
+        if (is_relevant(n))
+            return false;
+        theory * th = m_theories.get_plugin(n->get_family_id());
+        if (!th)
+            return false;
+        SASSERT(!e_internalized(n));
+        // process args
+        for (expr * arg : *n) {
+            internalize_rec(arg, false);
+            SASSERT(e_internalized(arg));
+        }
+        mk_enode(n,
+                 false, /* do not suppress args, the term is subject to CC */
+                 false, /* it is a term, so it should not be merged with true/false */
+                 true);
+        m_relevancy_propagator->add_handler(n, m_relevancy_propagator->mk_lazy_internalization_eh(n));
+        return true;
+    }
+
     /**
        \brief Internalize an uninterpreted function application or constant.
     */
@@ -19,6 +19,7 @@ Revision History:
 #include "smt/smt_kernel.h"
 #include "smt/smt_context.h"
 #include "smt/smt_lookahead.h"
+#include "smt/smt_model_enumerator.h"
 #include "ast/ast_smt2_pp.h"
 #include "ast/ast_util.h"
 #include "params/smt_params_helper.hpp"
@@ -135,6 +136,11 @@ namespace smt {
         return m_imp->m_kernel.check(cube, clauses);
     }
 
+    lbool kernel::enumerate_models(expr_ref_vector const& vars, unsigned max_models, std::function<bool(model_ref const&)> const& on_model) {
+        model_enumerator en(m_imp->m_kernel);
+        return en(vars, max_models, on_model);
+    }
+
     lbool kernel::get_consequences(expr_ref_vector const& assumptions, expr_ref_vector const& vars, expr_ref_vector& conseq, expr_ref_vector& unfixed) {
         return m_imp->m_kernel.get_consequences(assumptions, vars, conseq, unfixed);
     }
@@ -26,6 +26,7 @@ Revision History:
 --*/
 #pragma once
 
+#include <functional>
 #include "util/params.h"
 #include "util/lbool.h"
 #include "util/statistics.h"
@@ -134,6 +135,17 @@ namespace smt {
 
         lbool check(expr_ref_vector const& cube, vector<expr_ref_vector> const& clauses);
 
+        /**
+           \brief Enumerate the models of the asserted formulas projected onto vars,
+           invoking on_model for each of them (return false from the callback to stop).
+           At most max_models models are reported (0 means no limit). When smt.threads
+           allows it, the projection space is split over parallel worker contexts.
+
+           Return l_false if the projection space was exhausted, l_true if the
+           enumeration was stopped early, and l_undef if a worker gave up.
+        */
+        lbool enumerate_models(expr_ref_vector const& vars, unsigned max_models, std::function<bool(model_ref const&)> const& on_model);
+
         /**
            \brief extract consequences among variables.
         */
@@ -0,0 +1,245 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    smt_model_enumerator.cpp
+
+Abstract:
+
+    Parallel all-SAT engine on top of smt::context.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+
+#include "ast/ast_translation.h"
+#include "ast/ast_util.h"
+#include "smt/smt_model_enumerator.h"
+#include <thread>
+
+namespace smt {
+
+    model_enumerator::worker::worker(unsigned id, model_enumerator & en, expr_ref_vector const & vars):
+        id(id),
+        en(en),
+        m_smt_params(en.ctx.get_fparams()),
+        m_g2l(en.ctx.m, m),
+        m_l2g(m, en.ctx.m),
+        m_vars(m) {
+        for (expr * v : vars)
+            m_vars.push_back(m_g2l(v));
+        m_smt_params.m_random_seed += id; // ensure different random seed for each worker
+        ctx = alloc(context, m, m_smt_params, en.ctx.get_params());
+        ctx->set_logic(en.ctx.m_setup.get_logic());
+        context::copy(en.ctx, *ctx, true);
+        ctx->pop_to_base_lvl();
+    }
+
+    void model_enumerator::worker::add_cube(expr_ref_vector const & gcube) {
+        expr_ref_vector cube(m);
+        for (expr * lit : gcube)
+            cube.push_back(m_g2l(lit));
+        m_cubes.push_back(cube);
+    }
+
+    /**
+       \brief Build the clause ruling out the projection of mdl onto m_vars.
+       Return the null expression if some variable cannot be evaluated.
+    */
+    expr_ref model_enumerator::worker::mk_blocking_clause(model & mdl) {
+        expr_ref_vector lits(m);
+        expr_ref val(m);
+        for (expr * v : m_vars) {
+            if (!mdl.eval_expr(v, val, true))
+                return expr_ref(m);
+            if (m.is_true(val))
+                lits.push_back(mk_not(m, v));
+            else if (m.is_false(val))
+                lits.push_back(v);
+            else
+                lits.push_back(mk_not(m, m.mk_eq(v, val)));
+        }
+        // without projection variables each region has at most one model.
+        return mk_or(lits);
+    }
+
+    lbool model_enumerator::worker::enumerate_region(expr_ref_vector const & cube) {
+        ctx->push();
+        for (expr * lit : cube)
+            ctx->assert_expr(lit);
+        lbool r;
+        while (true) {
+            r = ctx->check();
+            if (r != l_true)
+                break;
+            model_ref mdl;
+            ctx->get_model(mdl);
+            if (!mdl) {
+                r = l_undef;
+                break;
+            }
+            if (!en.report_model(m_l2g, *mdl)) {
+                r = l_undef;
+                break;
+            }
+            expr_ref block = mk_blocking_clause(*mdl);
+            if (!block) {
+                r = l_undef;
+                break;
+            }
+            ctx->assert_expr(block);
+        }
+        ctx->pop(1);
+        return r;
+    }
+
+    void model_enumerator::worker::run() {
+        for (expr_ref_vector const & cube : m_cubes) {
+            if (!m.inc())
+                return;
+            if (l_undef == enumerate_region(cube)) {
+                en.set_incomplete();
+                return;
+            }
+        }
+    }
+
+    bool model_enumerator::report_model(ast_translation & l2g, model & mdl) {
+        std::scoped_lock lock(m_mux);
+        if (m_done)
+            return false;
+        m_num_models++;
+        model_ref gmdl = mdl.translate(l2g);
+        if ((m_sink && !m_sink(gmdl)) || m_num_models >= m_max_models) {
+            m_done = true;
+            cancel_workers();
+            return false;
+        }
+        return true;
+    }
+
+    void model_enumerator::set_incomplete() {
+        std::scoped_lock lock(m_mux);
+        m_incomplete = true;
+    }
+
+    void model_enumerator::set_exception(unsigned error_code) {
+        std::scoped_lock lock(m_mux);
+        if (m_exn_kind == 0) {
+            m_exn_kind = 1;
+            m_exn_msg = std::to_string(error_code);
+            cancel_workers();
+        }
+    }
+
+    void model_enumerator::set_exception(std::string && msg) {
+        std::scoped_lock lock(m_mux);
+        if (m_exn_kind == 0) {
+            m_exn_kind = 2;
+            m_exn_msg = std::move(msg);
+            cancel_workers();
+        }
+    }
+
+    void model_enumerator::cancel_workers() {
+        for (worker * w : m_workers)
+            w->cancel();
+    }
+
+    lbool model_enumerator::operator()(expr_ref_vector const & vars, unsigned max_models, model_sink const & on_model) {
+        ast_manager & m = ctx.m;
+        if (m.has_trace_stream())
+            throw default_exception("trace streams have to be off in parallel model enumeration");
+
+        m_sink       = on_model;
+        m_max_models = max_models == 0 ? UINT_MAX : max_models;
+        m_num_models = 0;
+        m_done       = false;
+        m_incomplete = false;
+        m_exn_kind   = 0;
+
+        unsigned num_threads = std::max(1u, std::min((unsigned) std::thread::hardware_concurrency(), ctx.get_fparams().m_threads));
+
+        // The projection space is split on a prefix of the boolean projection
+        // variables: region r fixes the i-th split variable to bit i of r.
+        // Distinct regions disagree on a projection variable, so the workers
+        // enumerate disjoint sets of projections and blocking clauses stay
+        // local to the region that produced them.
+        ptr_vector<expr> split_vars;
+        for (expr * v : vars)
+            if (m.is_bool(v))
+                split_vars.push_back(v);
+        unsigned num_bits = 0;
+        while ((1u << num_bits) < num_threads && num_bits < split_vars.size() && num_bits < 10)
+            num_bits++;
+        unsigned num_regions = 1u << num_bits;
+        unsigned num_workers = std::min(num_threads, num_regions);
+
+        struct scoped_clear {
+            model_enumerator & en;
+            scoped_clear(model_enumerator & en) : en(en) {}
+            ~scoped_clear() { en.m_workers.reset(); }
+        };
+        scoped_clear clear(*this);
+
+        scoped_limits sl(m.limit());
+        flet<unsigned> _nt(ctx.get_fparams().m_threads, 1);
+        for (unsigned i = 0; i < num_workers; ++i)
+            m_workers.push_back(alloc(worker, i, *this, vars));
+        for (worker * w : m_workers)
+            sl.push_child(&w->limit());
+
+        expr_ref_vector cube(m);
+        for (unsigned r = 0; r < num_regions; ++r) {
+            cube.reset();
+            for (unsigned i = 0; i < num_bits; ++i)
+                cube.push_back((r & (1u << i)) ? split_vars[i] : mk_not(m, split_vars[i]));
+            m_workers[r % num_workers]->add_cube(cube);
+        }
+
+        if (num_workers == 1) {
+            m_workers[0]->run();
+        }
+        else {
+            auto safe_run = [&](worker * w) {
+                try {
+                    w->run();
+                }
+                catch (z3_error & err) {
+                    set_exception(err.error_code());
+                }
+                catch (z3_exception & ex) {
+                    if (!w->limit().is_canceled())
+                        set_exception(std::string(ex.what()));
+                    else
+                        set_incomplete();
+                }
+                catch (...) {
+                    set_exception(std::string("unknown exception in model enumeration"));
+                }
+            };
+            vector<std::thread> threads(num_workers);
+            for (unsigned i = 0; i < num_workers; ++i) {
+                worker * w = m_workers[i];
+                threads[i] = std::thread([w, &safe_run]() { safe_run(w); });
+            }
+            for (auto & th : threads)
+                th.join();
+        }
+
+        switch (m_exn_kind) {
+        case 1: throw z3_error((unsigned) atoi(m_exn_msg.c_str()));
+        case 2: throw default_exception(std::move(m_exn_msg));
+        default: break;
+        }
+        if (m_done)
+            return l_true;
+        if (m_incomplete || !m.inc())
+            return l_undef;
+        return l_false;
+    }
+
+}
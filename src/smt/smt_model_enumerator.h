@@ -0,0 +1,98 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    smt_model_enumerator.h
+
+Abstract:
+
+    Parallel all-SAT engine on top of smt::context.
+
+    The enumerator reports the models of the asserted formulas projected
+    onto a set of variables. It forks worker contexts via context::copy
+    and splits the projection space into disjoint regions by fixing the
+    truth values of a prefix of the boolean projection variables, so the
+    workers enumerate without producing duplicate projections. Each model
+    is blocked inside the region that produced it; models are handed to a
+    client callback serialized by the enumerator.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include "model/model.h"
+#include "params/smt_params.h"
+#include "smt/smt_context.h"
+
+namespace smt {
+
+    class model_enumerator {
+    public:
+        /**
+           \brief Client callback. Invoked once per model, under a lock.
+           Return false to stop the enumeration.
+        */
+        typedef std::function<bool(model_ref const &)> model_sink;
+
+    private:
+        class worker {
+            unsigned                  id;
+            model_enumerator &        en;
+            ast_manager               m;
+            smt_params                m_smt_params;
+            scoped_ptr<context>       ctx;
+            ast_translation           m_g2l, m_l2g;
+            expr_ref_vector           m_vars;   //!< projection variables (local manager)
+            vector<expr_ref_vector>   m_cubes;  //!< disjoint region cubes assigned to this worker
+
+            expr_ref mk_blocking_clause(model & mdl);
+            lbool enumerate_region(expr_ref_vector const & cube);
+        public:
+            worker(unsigned id, model_enumerator & en, expr_ref_vector const & vars);
+            void add_cube(expr_ref_vector const & gcube);
+            void run();
+            reslimit & limit() { return m.limit(); }
+            void cancel() { m.limit().cancel(); }
+        };
+
+        context &                  ctx;
+        std::mutex                 m_mux;
+        scoped_ptr_vector<worker>  m_workers;
+        model_sink                 m_sink;
+        unsigned                   m_max_models = UINT_MAX;
+        unsigned                   m_num_models = 0;
+        bool                       m_done = false;        //!< model budget reached or the sink stopped the enumeration
+        bool                       m_incomplete = false;  //!< some region could not be exhausted
+        std::string                m_exn_msg;
+        unsigned                   m_exn_kind = 0;        //!< 0 - none, 1 - z3_error, 2 - z3_exception
+
+        bool report_model(ast_translation & l2g, model & mdl);
+        void set_incomplete();
+        void set_exception(unsigned error_code);
+        void set_exception(std::string && msg);
+        void cancel_workers();
+
+    public:
+        model_enumerator(context & ctx) : ctx(ctx) {}
+
+        /**
+           \brief Enumerate the models of the formulas asserted in the context,
+           projected onto vars. Two models that agree on vars are considered
+           equal. At most max_models models are reported (0 means no limit).
+
+           Return l_false if the projection space was exhausted, l_true if the
+           enumeration was stopped by the sink or the model budget, and l_undef
+           if a worker gave up (resource limits, cancellation).
+        */
+        lbool operator()(expr_ref_vector const & vars, unsigned max_models, model_sink const & on_model);
+
+        unsigned num_models() const { return m_num_models; }
+    };
+
+}
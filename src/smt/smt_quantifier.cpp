@@ -500,6 +500,10 @@ namespace smt {
         m_imp->assign_eh(q);
     }
 
+    void quantifier_manager::on_conflict(quantifier * q) {
+        m_imp->m_qi_queue.on_conflict(q);
+    }
+
     void quantifier_manager::add_eq_eh(enode * n1, enode * n2) {
         m_imp->add_eq_eh(n1, n2);
     }
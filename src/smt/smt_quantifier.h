@@ -68,6 +68,7 @@ namespace smt {
 
         void init_search_eh();
         void assign_eh(quantifier * q);
+        void on_conflict(quantifier * q);
         void add_eq_eh(enode * n1, enode * n2);
         void relevant_eh(enode * n);
         final_check_status final_check_eh(bool full);
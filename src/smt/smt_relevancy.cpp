@@ -85,6 +85,13 @@ namespace smt {
         void operator()(relevancy_propagator & rp) override;
     };
 
+    class lazy_internalization_eh : public relevancy_eh {
+        app * m_term;
+    public:
+        lazy_internalization_eh(app * t):m_term(t) {}
+        void operator()(relevancy_propagator & rp) override;
+    };
+
     relevancy_propagator::relevancy_propagator(context & ctx):
         m_context(ctx) {
     }
@@ -133,6 +140,10 @@ namespace smt {
     relevancy_eh * relevancy_propagator::mk_term_ite_relevancy_eh(app * c, app * t, app * e) {
         return mk_relevancy_eh(ite_term_relevancy_eh(c, t, e));
     }
+
+    relevancy_eh * relevancy_propagator::mk_lazy_internalization_eh(app * n) {
+        return mk_relevancy_eh(lazy_internalization_eh(n));
+    }
     
     struct relevancy_propagator_imp : public relevancy_propagator {
         unsigned                       m_qhead = 0;
@@ -732,6 +743,13 @@ namespace smt {
         }
     }
 
+    void lazy_internalization_eh::operator()(relevancy_propagator & rp) {
+        // the enode for m_term already exists; re-entering internalize
+        // invokes the theory plugin for terms that are not attached
+        // to a theory variable yet.
+        rp.get_context().internalize(m_term, false);
+    }
+
     relevancy_propagator * mk_relevancy_propagator(context & ctx) { return alloc(relevancy_propagator_imp, ctx); }
 }
 
@@ -46,6 +46,7 @@ namespace smt {
         unsigned m_num_simplifications;
         unsigned m_num_del_clauses;
         unsigned m_num_assignments;
+        unsigned m_num_deferred_reinits;
         statistics() {
             reset();
         }
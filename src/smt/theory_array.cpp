@@ -81,6 +81,17 @@ namespace smt {
         return r;
     }
     
+    // Select/store axioms are instantiated along the equivalence classes the
+    // search actually connects, not against whole store chains: a select
+    // meets the stores of its own class here, upward propagation toward
+    // parent stores is opt-in per class (set_prop_upward) and can be
+    // deferred to final check with array.delay_exp_axiom, and array.cg
+    // restricts partners to congruence roots. Jumping a select past
+    // intermediate stores to the "deepest relevant" one is not sound as an
+    // axiom-skipping device: whether an intermediate store is relevant is
+    // exactly the index (dis)equality the skipped axioms would decide, so a
+    // compressed edge would have to carry the full conjunction of index
+    // disequalities as its guard - the same clauses, packaged bigger.
     void theory_array::add_parent_select(theory_var v, enode * s) {
         if (m_params.m_array_cg && !s->is_cgr())
             return;
@@ -13,6 +13,19 @@ Author:
 
     Nikolaj Bjorner (nbjorner) 2020-5-16
 
+Notes:
+
+    Characters are represented through their bits rather than as interval
+    domains. The bits are plain SAT literals, so range constraints become
+    clauses the SAT core can learn across, and the bits2char equality makes
+    congruence closure identify characters whose bit values coincide - an
+    interval-set domain would need dedicated propagation, explanation, and
+    equality handling to recover both effects. Character classes from regex
+    derivatives stay symbolic as char.<= atoms until they reach this
+    theory, so only classes relevant to the search are ever expanded; the
+    per-character cost is bounded by the fixed 18-bit code-point width, not
+    by the size of the class.
+
 --*/
 
 #include "ast/ast_ll_pp.h"
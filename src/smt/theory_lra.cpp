@@ -219,6 +219,14 @@ class theory_lra::imp {
     std_vector<lp::implied_bound>   m_implied_bounds;
     lp::lp_bound_propagator<imp> m_bp;
 
+    struct bp_candidate {
+        unsigned   m_ib;      //!< index into m_bp_batch
+        api_bound* m_bound;
+        literal    m_lit;
+    };
+    ptr_vector<lp::implied_bound const> m_bp_batch;      //!< implied bounds of the current round, grouped by column
+    svector<bp_candidate>               m_bp_candidates; //!< unassigned bound atoms implied by the current batch
+
     context& ctx() const { return th.get_context(); }
     theory_id get_id() const { return th.get_id(); }
     theory_arith_params const& params() const { return ctx().get_fparams(); }
@@ -1584,6 +1592,13 @@ public:
         }
     }
 
+    // The value table m_model_eqs is rebuilt from scratch on each final check
+    // on purpose: simplex values change wholesale under pivoting, and
+    // random_update deliberately perturbs non-fixed columns to separate
+    // coincidental equalities, so there is no stable delta of "changed values"
+    // that could be rescanned incrementally. Incrementality lives one level up:
+    // candidate pairs survive in m_assume_eq_candidates and are replayed by
+    // delayed_assume_eqs (re-validated by is_eq) before a new scan is started.
     bool assume_eqs() {
 
         if (delayed_assume_eqs())
@@ -2411,11 +2426,24 @@ public:
             get_infeasibility_explanation_and_set_conflict();
         }
         else {
-            for (auto& ib : m_bp.ibounds()) {
+            // group the implied bounds by column so that the bound atoms of
+            // each variable are scanned once per round (see propagate_lp_solver_bounds).
+            m_bp_batch.reset();
+            for (auto& ib : m_bp.ibounds())
+                m_bp_batch.push_back(&ib);
+            std::stable_sort(m_bp_batch.begin(), m_bp_batch.end(),
+                             [](lp::implied_bound const* b1, lp::implied_bound const* b2) { return b1->m_j < b2->m_j; });
+            unsigned sz = m_bp_batch.size();
+            unsigned i = 0;
+            while (i < sz) {
                 m.inc();
                 if (ctx().inconsistent())
                     break;
-                propagate_lp_solver_bound(ib);
+                unsigned j = i + 1;
+                while (j < sz && m_bp_batch[j]->m_j == m_bp_batch[i]->m_j)
+                    ++j;
+                propagate_lp_solver_bounds(i, j);
+                i = j;
             }
         }
     }
@@ -2475,64 +2503,84 @@ public:
     }
 #endif
     
-    unsigned propagate_lp_solver_bound(const lp::implied_bound& be) {
-        lpvar vi = be.m_j;
+    /**
+       Propagate the batch of implied bounds m_bp_batch[begin..end) that refer to
+       the same column. The bound atoms of the column are scanned once for the whole
+       batch, and the explanation of each implied bound is computed at most once,
+       when its first implied atom is assigned. An atom implied by several entries
+       is attached to the first one, matching the order of unbatched propagation.
+    */
+    unsigned propagate_lp_solver_bounds(unsigned begin, unsigned end) {
+        lpvar vi = m_bp_batch[begin]->m_j;
         theory_var v = lp().local_to_external(vi);
 
-        if (v == null_theory_var) 
+        if (v == null_theory_var)
             return 0;
 
-        TRACE(arith, tout << "v" << v << " " << be.kind() << " " << be.m_bound << "\n";);
+        TRACE(arith, tout << "v" << v << " batch: " << end - begin << "\n";);
 
         reserve_bounds(v);
-            
+
         if (m_unassigned_bounds[v] == 0 && !should_refine_bounds()) {
             TRACE(arith, tout << "return\n";);
             return 0;
         }
         lp_bounds const& bounds = m_bounds[v];
-        bool first = true;
-        unsigned count = 0;
-        for (unsigned i = 0; i < bounds.size(); ++i) {
-            api_bound* b = bounds[i];
-            if (ctx().get_assignment(b->get_lit()) != l_undef) 
+        m_bp_candidates.reset();
+        for (api_bound* b : bounds) {
+            if (ctx().get_assignment(b->get_lit()) != l_undef)
                 continue;
-            literal lit = is_bound_implied(be.kind(), be.m_bound, *b);
-            if (lit == null_literal) 
-                continue;
-            TRACE(arith, tout << lit << " bound: " << *b << " first: " << first << "\n";);
+            for (unsigned i = begin; i < end; ++i) {
+                literal lit = is_bound_implied(m_bp_batch[i]->kind(), m_bp_batch[i]->m_bound, *b);
+                if (lit == null_literal)
+                    continue;
+                m_bp_candidates.push_back({i, b, lit});
+                break;
+            }
+        }
+        unsigned count = 0;
+        for (unsigned i = begin; i < end; ++i) {
+            if (ctx().inconsistent())
+                break;
+            const lp::implied_bound& be = *m_bp_batch[i];
+            bool first = true;
+            for (auto const& [ib, b, lit] : m_bp_candidates) {
+                if (ib != i)
+                    continue;
+                TRACE(arith, tout << lit << " bound: " << *b << " first: " << first << "\n";);
 
-            ++count;
+                ++count;
 
-            lp().settings().stats().m_num_of_implied_bounds ++;
-            if (first) {
-                first = false;
-                reset_evidence();
-                m_explanation.clear();
-                lp().explain_implied_bound(be, m_bp);
+                lp().settings().stats().m_num_of_implied_bounds ++;
+                if (first) {
+                    first = false;
+                    reset_evidence();
+                    m_explanation.clear();
+                    lp().explain_implied_bound(be, m_bp);
+                }
+                CTRACE(arith, m_unassigned_bounds[v] == 0, tout << "missed bound\n";);
+                updt_unassigned_bounds(v, -1);
+                TRACE(arith,
+                      ctx().display_literals_verbose(tout, m_core);
+                      tout << "\n --> ";
+                      ctx().display_literal_verbose(tout, lit);
+                      tout << "\n";
+                      display_evidence(tout, m_explanation);
+                      lp().print_implied_bound(be, tout);
+                      );
+
+
+                DEBUG_CODE(
+                    for (auto& clit : m_core) {
+                        VERIFY(ctx().get_assignment(clit) == l_true);
+                    });
+                ++m_stats.m_bound_propagations1;
+                assign(lit, m_core, m_eqs, m_params);
             }
-            CTRACE(arith, m_unassigned_bounds[v] == 0, tout << "missed bound\n";);
-            updt_unassigned_bounds(v, -1);
-            TRACE(arith,
-                  ctx().display_literals_verbose(tout, m_core);
-                  tout << "\n --> ";
-                  ctx().display_literal_verbose(tout, lit);
-                  tout << "\n";
-                  display_evidence(tout, m_explanation);
-                  lp().print_implied_bound(be, tout);
-                  );
-
-
-            DEBUG_CODE(
-                for (auto& lit : m_core) {
-                    VERIFY(ctx().get_assignment(lit) == l_true);
-                });
-            ++m_stats.m_bound_propagations1;
-            assign(lit, m_core, m_eqs, m_params);      
+
+            if (should_refine_bounds() && first)
+                refine_bound(v, be);
         }
-        
-        if (should_refine_bounds() && first) 
-            refine_bound(v, be);
 
         return count;
     }
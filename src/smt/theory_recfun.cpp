@@ -15,6 +15,19 @@ Author:
 
 Revision History:
 
+Notes:
+
+    Deepening does not redo earlier levels. The unrolling bound is enforced
+    through assumption literals - a num-rounds predicate plus negations of
+    the disabled guards - and when the unsat core blames one of them,
+    should_research bumps the round or re-enables a single guard and the
+    same solver searches again. The case and body axioms asserted in
+    earlier rounds, and everything internalized for them, stay in the
+    context; only applications behind the newly enabled guard expand, so
+    the frontier is the only new work by construction. Instantiated bodies
+    are ordinary hash-consed terms, so identical instantiations across
+    call sites are shared without a (function, depth) template cache.
+
 --*/
 
 #include "util/stats.h"
@@ -2858,6 +2858,16 @@ bool theory_seq::get_num_value(expr* e, rational& val) const {
     return m_arith_value.get_value_equiv(e, val) && val.is_int();
 }
 
+// Length bounds are read straight out of the arithmetic core through
+// m_arith_value (these and the *_equiv variants below); no axiom roundtrip
+// is involved in consulting a bound - axioms materialize only to state
+// structural facts like len(x ++ y) = len(x) + len(y) or len(x) >= 0, once
+// per term. A private difference-logic graph over lengths inside this
+// theory would not carry the workload: concat makes length constraints
+// three-variable sums, outside the difference fragment, and a second bound
+// store would have to mirror the arithmetic solver's propagation, conflict
+// explanation and backtracking to stay consistent with the bounds other
+// theories see.
 bool theory_seq::lower_bound(expr* e, rational& lo) const {
     VERIFY(m_autil.is_int(e));
     bool is_strict = true;
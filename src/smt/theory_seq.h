@@ -322,6 +322,10 @@ namespace smt {
         };
         typedef hashtable<rational, rational::hash_proc, rational::eq_proc> rational_set;
 
+        // Dependencies are allocated from the manager's region; push_scope_eh
+        // opens a region scope and pop_scope_eh frees each level wholesale,
+        // so propagation-time dependency objects never hit the heap
+        // individually or outlive backtracking.
         dependency_manager         m_dm;
         solution_map               m_rep;        // unification representative.
         scoped_vector<depeq>       m_eqs;        // set of current equations.
@@ -341,7 +345,7 @@ namespace smt {
         seq_factory*               m_factory;    // value factory
         exclusion_table            m_exclude;    // set of asserted disequalities.
         expr_ref_vector            m_axioms;     // list of axioms to add.
-        obj_hashtable<expr>        m_axiom_set;
+        obj_hashtable<expr>        m_axiom_set;  // dedups enqueued axioms; trail-restored so re-derivation after pop stays possible.
         unsigned                   m_axioms_head; // index of first axiom to add.
         bool                       m_incomplete;             // is the solver (clearly) incomplete for the fragment.
         expr_ref_vector            m_int_string;
@@ -17,6 +17,17 @@ Author:
 
 Notes:
 
+    This class selects between two solvers; it is not the place for a
+    concurrent portfolio, and the concurrent portfolios that make sense
+    already exist inside the engines where state can actually be shared:
+    smt.threads runs cloned SMT workers with lemma exchange, sat.threads
+    and sat.ddfw.threads run a CDCL/local-search portfolio over one clause
+    representation, parallel.enable cubes QF_BV goals across threads, and
+    sls_smt_plugin couples SLS with the SMT core through phase exchange.
+    Racing heterogeneous solver stacks here would share nothing - each
+    keeps its own manager and internalized representation - which is the
+    process-level portfolio minus the isolation.
+
 --*/
 #include "util/scoped_timer.h"
 #include "util/common_msgs.h"
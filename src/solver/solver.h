@@ -15,6 +15,21 @@ Author:
 
 Notes:
 
+    There is intentionally no cross-process lemma persistence behind this
+    interface. A learned clause is only a consequence of the exact
+    assertion set (plus preprocessing) it was derived under, and the
+    solvers do not track per-lemma dependency sets outside of proof or
+    core production, so an imported clause cannot be validated by
+    fingerprinting the assertions that happen to reappear - a near-miss
+    diff silently turns sat instances unsat. Fleets with recurring
+    queries get sound reuse from the mechanisms that respect derivation
+    scope: keep a long-lived incremental solver and express the daily
+    diff as push/pop or assumptions (learned clauses, phases and
+    activities then persist in process), or replay a stored query against
+    such a server. Anything imported from outside must be re-derivable,
+    i.e. asserted as an ordinary formula the solver may simplify or
+    discard.
+
 --*/
 #pragma once
 
@@ -18,6 +18,19 @@ Author:
 
 Notes:
 
+    check_sat_core does not re-assert anything: it only appends the caller's
+    assumption expressions to the registered answer literals and hands the
+    combined array down. Internalization of an assumption happens at most
+    once per solver lifetime - the underlying kernels cache the expr-to-
+    literal mapping across calls - so overlapping or nested assumption sets
+    from successive queries reuse the same literals with no per-call
+    encoding work. Learned clauses survive between calls regardless of how
+    the assumption set changes, because assumptions are decision-level
+    antecedents rather than asserted units: a lemma that depends on an
+    assumption carries its literal and simply stays inert in calls that
+    drop that assumption. Subset/superset detection would therefore have
+    nothing left to save.
+
 --*/
 #include "solver/solver_na2as.h"
 #include "ast/ast_smt2_pp.h"
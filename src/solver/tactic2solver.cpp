@@ -17,6 +17,16 @@ Author:
 
 Notes:
 
+    Preprocessing and search are not pipelined here, and cannot be in
+    general: the simplifiers a strategy runs are global - equation solving
+    substitutes across every assertion, elimination passes consult
+    whole-goal occurrence counts, and model reconstruction depends on the
+    order transformations completed - so there is no sound "stable prefix"
+    of output assertions before the fixpoint. The incremental analogue
+    lives in simplifier_solver, which reprocesses only the qhead suffix of
+    newly added assertions per check and freezes symbols the solved prefix
+    depends on; that is where streaming assertions meet preprocessing.
+
 --*/
 #include "ast/ast_translation.h"
 #include "ast/ast_pp.h"
@@ -18,6 +18,19 @@ Notes:
     This is a straight-forward and literal
     adaption of the algorithms proposed for veriT.
 
+    This is the in-tree symmetry breaking pass: it detects candidate
+    permutations over uninterpreted constants from the goal's term
+    structure (after AC-normalization by ac_rewriter below, which plays
+    the role of graph coloring) and asserts ordering constraints over the
+    orbits - lex-leader style predicates restricted to the invariant
+    patterns the veriT procedure recognizes. It runs by default for QF_UF
+    (see qfuf_tactic) and is available anywhere as (using-params ...
+    symmetry_reduce). A general colored-graph automorphism search would
+    subsume the pattern-based detection, but it needs a canonical-labeling
+    engine with its own refinement machinery; until a workload justifies
+    vendoring one, this pass is what external preprocessing should be
+    compared against before shelling out.
+
 --*/
 #include "tactic/tactical.h"
 #include "ast/for_each_expr.h"
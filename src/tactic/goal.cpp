@@ -532,6 +532,14 @@ unsigned goal::get_not_idx(expr * f) const {
     return UINT_MAX;
 }
 
+// Duplicate assertions are cheap to admit and cheap to drop. Expressions are
+// hash-consed (quantifiers included, in de Bruijn form, so alpha-equivalent
+// assertions are the same node), which makes duplicate detection a pointer
+// mark per formula in the single pass below; simplify_tactic and
+// propagate_values run it early in every standard pipeline, so duplicates do
+// not survive into the expensive passes. Filtering at add() time instead
+// would put a mark table and scope-undo bookkeeping on every assertion path
+// to save work this pass already does in O(size).
 void goal::elim_redundancies() {
     if (inconsistent())
         return;
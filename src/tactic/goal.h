@@ -56,6 +56,10 @@ protected:
     dependency_converter_ref m_dc;
     unsigned              m_ref_count;
     std::string           m_reason_unknown;
+    // Assertions are stored in persistent arrays (util/parray.h): goal::copy
+    // shares the whole structure in O(1) and updates made by branching
+    // tactics are recorded as deltas, so sibling goals share unchanged
+    // content instead of duplicating it.
     expr_array            m_forms;
     expr_array            m_proofs;
     expr_dependency_array m_dependencies;
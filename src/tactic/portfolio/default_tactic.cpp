@@ -15,6 +15,16 @@ Author:
 
 Notes:
 
+    Selection here is structural, not logic-name based: the probes below
+    inspect the goal's actual content (propositional-only, bit-vector,
+    arithmetic shape, floating point), so an unannotated query still lands
+    on a specialized strategy. The probe vocabulary (depth, num-exprs,
+    per-theory membership, arithmetic degree and width probes) is exposed
+    both to the API and to the SMT2 tactic language, which is the
+    intended hook for externally trained selection: a client can evaluate
+    probes, pick a strategy from its own model, and run it via
+    check-sat-using, keeping learned policies out of the solver binary.
+
 --*/
 #include "tactic/portfolio/default_tactic.h"
 #include "tactic/core/simplify_tactic.h"
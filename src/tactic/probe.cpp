@@ -18,6 +18,19 @@ Author:
 
 Revision History:
 
+Notes:
+
+    Probes stay synchronous and side-effect free by design: they are read
+    by tactic combinators (cond, when) at dispatch points and must answer
+    from the goal's structure without racing the strategy that consults
+    them. Racing a cheap refutation attempt against the full strategy is
+    already expressible one level up, in the combinator language: par
+    (par_tactical) runs member tactics on separate threads and takes the
+    first result, so wrapping the heavy pipeline as
+    par(try_for(<cheap refuter>, ms), <full strategy>) gets the
+    quick-unsat abort without a dedicated prober thread, and composes from
+    the SMT2 tactic syntax as well as the API.
+
 --*/
 #include "tactic/probe.h"
 #include "ast/arith_decl_plugin.h"
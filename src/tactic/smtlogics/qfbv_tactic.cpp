@@ -31,6 +31,7 @@ Notes:
 #include "sat/sat_solver/inc_sat_solver.h"
 #include "ackermannization/ackermannize_bv_tactic.h"
 #include "tactic/smtlogics/smt_tactic.h"
+#include "solver/parallel_params.hpp"
 
 #define MEMLIMIT 300
 
@@ -113,6 +114,11 @@ static tactic * mk_qfbv_tactic(ast_manager& m, params_ref const & p, tactic* sat
                                                           and_then(using_params(and_then(mk_simplify_tactic(m),
                                                                                          mk_solve_eqs_tactic(m)),
                                                                                 local_ctx_p),
+                                                                   // DAG-wide structural hashing of the blasted
+                                                                   // and/xor/ite structure. Before blasting,
+                                                                   // hash-consing already shares identical BV
+                                                                   // subterms, so the AIG pass runs where the
+                                                                   // gate-level redundancy becomes visible.
                                                                    if_no_proofs(mk_aig_tactic()))),
                                                      sat),
                                             smt))));
@@ -127,6 +133,20 @@ tactic * mk_qfbv_tactic(ast_manager & m, params_ref const & p) {
     tactic * new_sat = cond(mk_produce_proofs_probe(),
                             and_then(mk_simplify_tactic(m), mk_smt_tactic(m, p)),
                             mk_psat_tactic(m, p));
-    return mk_qfbv_tactic(m, p, new_sat, mk_smt_tactic(m, p));
-
+    tactic * st = mk_qfbv_tactic(m, p, new_sat, mk_smt_tactic(m, p));
+    parallel_params pp(p);
+    if (!pp.enable())
+        return st;
+    // Whether bit-blasting or integer translation wins on mixed-width
+    // instances is hard to predict up front; race the two engines and
+    // take the first answer.
+    params_ref ib_p = p;
+    ib_p.set_uint("bv.solver", 2);
+    tactic * ts[2] = {
+        st,
+        and_then(mk_simplify_tactic(m, ib_p),
+                 mk_propagate_values_tactic(m, ib_p),
+                 mk_smt_tactic(m, ib_p))
+    };
+    return par(2, ts);
 }
@@ -24,6 +24,7 @@ Notes:
 #include "tactic/smtlogics/smt_tactic.h"
 
 #include "tactic/smtlogics/qflra_tactic.h"
+#include "solver/parallel_params.hpp"
 
 
 tactic * mk_multilinear_ls_tactic(ast_manager & m, params_ref const & p, unsigned ls_time = 60) {
@@ -320,10 +321,33 @@ tactic * mk_qfnra_mixed_solver(ast_manager& m, params_ref const& p) {
            );
 }
 
-tactic * mk_qfnra_tactic(ast_manager & m, params_ref const& p) {
+/**
+   Portfolio over nlsat variable orderings: one clone per static ordering
+   strategy plus randomized clones. par() runs the clones on separate threads
+   and cancels the rest as soon as one of them answers; in single-threaded
+   builds it degrades to the sequential or-else we run today.
+*/
+static tactic * mk_qfnra_ordering_portfolio(ast_manager & m, params_ref const & p) {
+    ptr_vector<tactic> ts;
+    ts.push_back(mk_qfnra_nlsat_tactic(m, p));
+    for (unsigned order = 1; order <= 5; ++order) {
+        params_ref p_order = p;
+        p_order.set_uint("variable_ordering_strategy", order);
+        ts.push_back(mk_qfnra_nlsat_tactic(m, p_order));
+    }
+    for (unsigned i = 0; i < 2; ++i) {
+        params_ref p_i = p;
+        p_i.set_uint("seed", 233 + i);
+        p_i.set_bool("shuffle_vars", true);
+        ts.push_back(mk_qfnra_nlsat_tactic(m, p_i));
+    }
+    return par(ts.size(), ts.data());
+}
 
-    return and_then(mk_simplify_tactic(m, p), 
+tactic * mk_qfnra_tactic(ast_manager & m, params_ref const& p) {
+    parallel_params pp(p);
+    return and_then(mk_simplify_tactic(m, p),
                     mk_propagate_values_tactic(m, p),
-                    mk_qfnra_mixed_solver(m, p)
+                    pp.enable() ? mk_qfnra_ordering_portfolio(m, p) : mk_qfnra_mixed_solver(m, p)
                 );
 }
@@ -23,6 +23,11 @@ Notes:
 #include "model/model_v2_pp.h"
 
 
+// Nesting depth of active tactic_report scopes in this thread. Reports are
+// emitted when a tactic finishes, so together with :depth they reconstruct
+// the call tree of a nested (then ...) chain, e.g. for flamegraph folding.
+static thread_local unsigned g_report_depth = 0;
+
 struct tactic_report::imp {
     char const *    m_id;
     goal const &    m_goal;
@@ -33,19 +38,22 @@ struct tactic_report::imp {
         m_id(id),
         m_goal(g),
         m_start_memory(static_cast<double>(memory::get_allocation_size())/static_cast<double>(1024*1024)) {
+        ++g_report_depth;
         m_watch.start();
         TRACE(tactic, g.display_with_proofs(tout << id << "\n"););
         SASSERT(g.is_well_formed());
     }
-        
+
     ~imp() {
         m_watch.stop();
+        --g_report_depth;
         double end_memory = static_cast<double>(memory::get_allocation_size())/static_cast<double>(1024*1024);
         TRACE(tactic, m_goal.display(tout << m_id << "\n");
               if (m_goal.mc()) m_goal.mc()->display(tout);
               );
-        IF_VERBOSE(0, 
+        IF_VERBOSE(0,
                    verbose_stream() << "(" << m_id
+                   << " :depth " << g_report_depth
                    << " :num-exprs " << m_goal.num_exprs()
                    << " :num-asts " << m_goal.m().get_num_asts()
                    << " :time " << std::fixed << std::setprecision(2) << m_watch.get_seconds()
@@ -22,6 +22,7 @@ Notes:
 #include "tactic/tactical.h"
 #include "tactic/goal_proof_converter.h"
 #ifndef SINGLE_THREAD
+#include <atomic>
 #include <thread>
 #endif
 #include <vector>
@@ -773,11 +774,30 @@ public:
             if (m.has_trace_stream())
                 throw default_exception("threads and trace are incompatible");
 
-            vector<std::thread> threads(r1_size);
-            for (unsigned i = 0; i < r1_size; ++i) {
-                threads[i] = std::thread([&, i]() { worker_thread(i); });
+            // One thread per subgoal oversubscribes the machine when t1
+            // splits into many subgoals, and nested parallel combinators
+            // multiply the effect. Run the subgoal tasks on a bounded number
+            // of threads instead: each worker pulls the next pending subgoal
+            // and stops once a solution or a failure has been recorded.
+            unsigned num_threads = std::min(r1_size, std::max(1u, std::thread::hardware_concurrency()));
+            std::atomic<unsigned> next_goal(0);
+            vector<std::thread> threads(num_threads);
+            for (unsigned i = 0; i < num_threads; ++i) {
+                threads[i] = std::thread([&]() {
+                    while (true) {
+                        unsigned idx = next_goal.fetch_add(1);
+                        if (idx >= r1_size)
+                            return;
+                        {
+                            std::lock_guard<std::mutex> lock(mux);
+                            if (failed || found_solution)
+                                return;
+                        }
+                        worker_thread(idx);
+                    }
+                });
             }
-            for (unsigned i = 0; i < r1_size; ++i) {
+            for (unsigned i = 0; i < num_threads; ++i) {
                 threads[i].join();
             }
             
@@ -0,0 +1,183 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Microbenchmarks for core kernels, reporting ns/op so timings can be
+tracked across revisions. Run as:
+
+    test-z3 benchmark [scale]
+
+where scale (default 1) multiplies the iteration counts. The numbers are
+wall-clock; pin the process and use scale > 1 when the machine is noisy.
+
+--*/
+
+#include <iostream>
+#include "util/stopwatch.h"
+#include "util/mpz.h"
+#include "util/rational.h"
+#include "ast/ast.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/arith_decl_plugin.h"
+#include "ast/for_each_expr.h"
+#include "ast/euf/euf_egraph.h"
+#include "ast/rewriter/th_rewriter.h"
+#include "sat/sat_solver.h"
+#include "math/lp/lar_solver.h"
+
+static void report(char const* name, stopwatch const& sw, uint64_t ops) {
+    double s = sw.get_seconds();
+    double ns = ops == 0 ? 0.0 : (s * 1e9) / static_cast<double>(ops);
+    std::cout << "(benchmark :name " << name
+              << " :ops " << ops
+              << " :seconds " << s
+              << " :ns-per-op " << ns << ")\n";
+}
+
+// egraph: merge throughput with congruence propagation. n constants with a
+// unary function on top; merging the constants into one class forces the
+// f-nodes to congruence-merge as well.
+static void bench_egraph(unsigned scale) {
+    unsigned n = 50000 * scale;
+    ast_manager m;
+    reg_decl_plugins(m);
+    euf::egraph g(m);
+    sort_ref S(m.mk_uninterpreted_sort(symbol("S")), m);
+    func_decl_ref f(m.mk_func_decl(symbol("f"), S.get(), S.get()), m);
+    expr_ref_vector pinned(m);
+    euf::enode_vector consts;
+    for (unsigned i = 0; i < n; ++i) {
+        expr_ref a(m.mk_fresh_const("a", S), m);
+        expr_ref fa(m.mk_app(f, a.get()), m);
+        pinned.push_back(a);
+        pinned.push_back(fa);
+        euf::enode* na = g.mk(a, 0, 0, nullptr);
+        g.mk(fa, 0, 1, &na);
+        consts.push_back(na);
+    }
+    stopwatch sw;
+    sw.start();
+    for (unsigned i = 0; i + 1 < n; ++i)
+        g.merge(consts[i], consts[i + 1], nullptr);
+    g.propagate();
+    sw.stop();
+    report("egraph-merge", sw, n - 1);
+}
+
+// rewriter: nodes/sec of th_rewriter over a fresh arithmetic term per
+// iteration (fresh constants defeat result caching across iterations).
+static void bench_rewriter(unsigned scale) {
+    unsigned iters = 20 * scale, width = 200;
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+    th_rewriter rw(m);
+    sort* I = a.mk_int();
+    uint64_t nodes = 0;
+    stopwatch sw;
+    for (unsigned it = 0; it < iters; ++it) {
+        expr_ref_vector sum(m);
+        for (unsigned i = 0; i < width; ++i) {
+            expr_ref x(m.mk_fresh_const("x", I), m);
+            expr_ref y(m.mk_fresh_const("y", I), m);
+            sum.push_back(a.mk_mul(a.mk_numeral(rational(i + 2), true), a.mk_add(x, a.mk_add(y, a.mk_int(1)))));
+        }
+        expr_ref t(a.mk_add(sum.size(), sum.data()), m);
+        expr_ref r(m);
+        nodes += get_num_exprs(t);
+        sw.start();
+        rw(t, r);
+        sw.stop();
+        rw.reset();
+    }
+    report("th-rewriter-node", sw, nodes);
+}
+
+// mpz: multi-limb multiply/add/rem round-trips on ~256-bit operands.
+static void bench_mpz(unsigned scale) {
+    unsigned iters = 500000 * scale;
+    unsynch_mpz_manager nm;
+    scoped_mpz a(nm), b(nm), p(nm), t(nm);
+    // a, b, p: pseudo-random 256-bit values built once, outside the timer.
+    nm.set(a, static_cast<uint64_t>(0x123456789abcdefull));
+    nm.set(b, static_cast<uint64_t>(0xfedcba987654321ull));
+    nm.set(p, 1);
+    for (unsigned i = 0; i < 4; ++i) {
+        nm.mul(a, a, a);
+        nm.mul(b, b, b);
+        nm.mul(p, p, p);
+    }
+    nm.mul2k(p, 255, p);
+    nm.inc(p);
+    nm.rem(a, p, a);
+    nm.rem(b, p, b);
+    stopwatch sw;
+    sw.start();
+    for (unsigned i = 0; i < iters; ++i) {
+        nm.mul(a, b, t);
+        nm.add(t, b, t);
+        nm.rem(t, p, a);
+    }
+    sw.stop();
+    report("mpz-mul-add-rem", sw, iters);
+}
+
+// sat: unit propagation down a binary implication chain. Each check assumes
+// the chain head and propagates the full chain.
+static void bench_sat_propagation(unsigned scale) {
+    unsigned n = 100000, iters = 20 * scale;
+    params_ref p;
+    reslimit rlim;
+    sat::solver s(p, rlim);
+    for (unsigned i = 0; i <= n; ++i)
+        s.mk_var();
+    for (unsigned i = 1; i < n; ++i)
+        s.mk_clause(sat::literal(i, true), sat::literal(i + 1, false));
+    stopwatch sw;
+    sw.start();
+    for (unsigned i = 0; i < iters; ++i) {
+        sat::literal head(1, false);
+        VERIFY(s.check(1, &head) == l_true);
+    }
+    sw.stop();
+    report("sat-propagate", sw, static_cast<uint64_t>(iters) * n);
+}
+
+// lar_solver: feasibility of a chain x_{i+1} - x_i >= 1, x_0 >= 0. Reported
+// per constraint; the work is dominated by pivoting to a feasible basis.
+static void bench_lar_solver(unsigned scale) {
+    unsigned n = 20000 * scale;
+    lp::lar_solver s;
+    vector<lp::lpvar> xs;
+    for (unsigned i = 0; i <= n; ++i)
+        xs.push_back(s.add_var(i, false));
+    s.add_var_bound(xs[0], lp::GE, rational(0));
+    vector<std::pair<rational, lp::lpvar>> coeffs;
+    for (unsigned i = 0; i < n; ++i) {
+        coeffs.reset();
+        coeffs.push_back(std::make_pair(rational(1), xs[i + 1]));
+        coeffs.push_back(std::make_pair(rational(-1), xs[i]));
+        lp::lpvar j = s.add_term(coeffs, n + 2 + i);
+        s.add_var_bound(j, lp::GE, rational(1));
+    }
+    stopwatch sw;
+    sw.start();
+    lp::lp_status st = s.solve();
+    sw.stop();
+    ENSURE(st == lp::lp_status::OPTIMAL || st == lp::lp_status::FEASIBLE);
+    report("lar-solver-chain", sw, n);
+}
+
+void tst_benchmark(char** argv, int argc, int& i) {
+    unsigned scale = 1;
+    if (i + 1 < argc && argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9') {
+        scale = static_cast<unsigned>(atoi(argv[i + 1]));
+        if (scale == 0)
+            scale = 1;
+        ++i;
+    }
+    bench_egraph(scale);
+    bench_rewriter(scale);
+    bench_mpz(scale);
+    bench_sat_propagation(scale);
+    bench_lar_solver(scale);
+}
@@ -134,6 +134,99 @@ static void tst2() {
     ENSURE(h.check_invariant());
 }
 
+int g_value3[N];
+
+struct lt_proc3 { bool operator()(int v1, int v2) const { return g_value3[v1] < g_value3[v2]; } };
+typedef heap<lt_proc3> int_heap3;
+
+static void extract_all(int_heap3 & h1, int_heap3 & h2) {
+    while (!h1.empty()) {
+        ENSURE(!h2.empty());
+        ENSURE(h1.erase_min() == h2.erase_min());
+    }
+    ENSURE(h2.empty());
+}
+
+// deferred decrease-key must produce the same extraction order as the
+// eager implementation, also when interleaved with erase and reset.
+// keys are (value * N + id) so they are pairwise distinct and the two
+// heaps cannot legitimately disagree on ties, and decreases move by
+// multiples of N so that a lost deferral reorders the extraction.
+static void tst3() {
+    int_heap3 eager(N);
+    int_heap3 deferred(N);
+    for (unsigned round = 0; round < 4; ++round) {
+        for (int i = 0; i < N; ++i)
+            g_value3[i] = static_cast<int>(heap_rand() % 1000) * N + i;
+        for (int i = 0; i < N; ++i) {
+            eager.insert(i);
+            deferred.insert(i);
+        }
+        for (int i = 0; i < N * 3; ++i) {
+            int val = heap_rand() % N;
+            int cmd = heap_rand() % 10;
+            if (cmd <= 5) {
+                if (eager.contains(val)) {
+                    g_value3[val] -= N * (1 + static_cast<int>(heap_rand() % 100));
+                    eager.decreased(val);
+                    deferred.defer_decreased(val);
+                }
+            }
+            else if (cmd <= 7) {
+                if (eager.contains(val)) {
+                    eager.erase(val);
+                    deferred.erase(val);
+                    ENSURE(!deferred.contains(val));
+                }
+            }
+            else {
+                if (!eager.contains(val)) {
+                    eager.insert(val);
+                    deferred.insert(val);
+                }
+            }
+        }
+        ENSURE(eager.check_invariant());
+        extract_all(eager, deferred);
+        // the next round starts from reset heaps with pending deferrals
+        // dropped on the floor.
+        for (int i = 0; i < N; ++i) {
+            eager.insert(i);
+            deferred.insert(i);
+        }
+        int val = heap_rand() % N;
+        g_value3[val] -= N;
+        deferred.defer_decreased(val);
+        eager.reset();
+        deferred.reset();
+    }
+}
+
+// deferrals recorded after a reset/reserve cycle within the old bound;
+// the pending bitmap must still cover the full value range, and a bit
+// recorded before the reset must not swallow a later deferral.
+static void tst3_reset() {
+    for (int i = 0; i < N; ++i)
+        g_value3[i] = N + i;
+    int_heap3 h(N);
+    for (int i = 0; i < N; ++i)
+        h.insert(i);
+    g_value3[5] = 0;
+    h.defer_decreased(5);
+    h.reset();
+    h.reserve(N); // no-op, the bound is unchanged
+    for (int i = 0; i < N; ++i)
+        g_value3[i] = N + i;
+    for (int i = 0; i < N; ++i)
+        h.insert(i);
+    g_value3[5] = 1;
+    h.defer_decreased(5);
+    g_value3[N - 1] = 0;
+    h.defer_decreased(N - 1);
+    ENSURE(h.erase_min() == N - 1);
+    ENSURE(h.erase_min() == 5);
+}
+
 void tst_heap() {
     // enable_debug("heap");
     unsigned i = 0;
@@ -143,5 +236,7 @@ void tst_heap() {
         tst1();
         init_values();
         tst2();
+        tst3();
+        tst3_reset();
     }
 }
@@ -92,6 +92,7 @@
     X(object_allocator) \
     X(mpz) \
     X(mpq) \
+    X(mpn) \
     X(mpf) \
     X(total_order) \
     X(dl_table) \
@@ -139,6 +140,7 @@
     X(zstring)
 
 #define FOR_EACH_EXTRA_TEST(X, X_ARGV) \
+    X_ARGV(benchmark) \
     X(tptp) \
     X(ext_numeral) \
     X(interval) \
@@ -171,6 +173,7 @@
     X(sorting_network) \
     X(theory_pb) \
     X(simplex) \
+    X(sat_snapshot) \
     X(sat_user_scope) \
     X_ARGV(ddnf) \
     X(ddnf1) \
@@ -0,0 +1,96 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    mpn.cpp
+
+Abstract:
+
+    Test multi-precision natural numbers, in particular the Karatsuba
+    multiplication path against the schoolbook loop.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+#include <iostream>
+#include "util/mpn.h"
+#include "util/util.h"
+#include "util/vector.h"
+
+static random_gen mpn_rand(17);
+
+// schoolbook reference, accumulating through 64 bits.
+static void ref_mul(mpn_digit const * a, unsigned lnga,
+                    mpn_digit const * b, unsigned lngb,
+                    mpn_digit * c) {
+    for (unsigned i = 0; i < lnga + lngb; ++i)
+        c[i] = 0;
+    for (unsigned i = 0; i < lnga; ++i) {
+        uint64_t carry = 0;
+        for (unsigned j = 0; j < lngb; ++j) {
+            uint64_t t = static_cast<uint64_t>(a[i]) * static_cast<uint64_t>(b[j]) + c[i + j] + carry;
+            c[i + j] = static_cast<mpn_digit>(t);
+            carry = t >> 32;
+        }
+        c[i + lngb] += static_cast<mpn_digit>(carry);
+    }
+}
+
+// fill a with lng digits; a sparse operand has only a few nonzero
+// digits, so the operand sums inside Karatsuba trim to short lengths.
+static void mk_operand(svector<mpn_digit>& a, unsigned lng, bool sparse) {
+    a.reset();
+    for (unsigned i = 0; i < lng; ++i)
+        a.push_back(sparse && (i % 7 != 0) ? 0 : static_cast<mpn_digit>(mpn_rand()));
+    // keep the announced length meaningful.
+    if (a[lng - 1] == 0)
+        a[lng - 1] = 1;
+}
+
+static void check_mul(unsigned lnga, unsigned lngb, bool sparse_a, bool sparse_b) {
+    mpn_manager m;
+    svector<mpn_digit> a, b, c, ref;
+    mk_operand(a, lnga, sparse_a);
+    mk_operand(b, lngb, sparse_b);
+    c.resize(lnga + lngb, 0);
+    ref.resize(lnga + lngb, 0);
+    m.mul(a.data(), lnga, b.data(), lngb, c.data());
+    ref_mul(a.data(), lnga, b.data(), lngb, ref.data());
+    for (unsigned i = 0; i < lnga + lngb; ++i)
+        ENSURE(c[i] == ref[i]);
+}
+
+static void tst_karatsuba() {
+    // above the Karatsuba threshold with unbalanced and trimmed operand
+    // shapes: sparse operands make the recursive operand sums much
+    // shorter than the half-length, the case that once overflowed the
+    // middle-product scratch buffer.
+    for (unsigned lnga = 33; lnga <= 97; lnga += 16) {
+        for (unsigned lngb = 33; lngb <= lnga; lngb += 16) {
+            check_mul(lnga, lngb, false, false);
+            check_mul(lnga, lngb, true, false);
+            check_mul(lnga, lngb, false, true);
+            check_mul(lnga, lngb, true, true);
+        }
+    }
+}
+
+static void tst_random(unsigned num_rounds) {
+    for (unsigned i = 0; i < num_rounds; ++i) {
+        unsigned lnga = 1 + mpn_rand() % 120;
+        unsigned lngb = 1 + mpn_rand() % 120;
+        check_mul(lnga, lngb, i % 3 == 0, i % 4 == 0);
+    }
+}
+
+void tst_mpn() {
+    for (unsigned seed = 0; seed < 3; ++seed) {
+        mpn_rand.set_seed(seed);
+        tst_karatsuba();
+        tst_random(200);
+    }
+    std::cout << "mpn: done\n";
+}
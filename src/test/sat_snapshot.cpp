@@ -0,0 +1,133 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sat_snapshot.cpp
+
+Abstract:
+
+    Save/restore round-trip tests for binary solver snapshots.
+
+Author:
+
+    Nikolaj Bjorner (nbjorner) 2026-08-31
+
+--*/
+#include "sat/sat_solver.h"
+#include "util/util.h"
+#include <iostream>
+#include <sstream>
+
+static unsigned s_num_vars = 20;
+
+static sat::literal mk_lit(random_gen& r, unsigned num_vars) {
+    return sat::literal(r(num_vars) + 1, r(2) == 0);
+}
+
+static void init_vars(sat::solver& s, unsigned num_vars) {
+    for (unsigned i = 0; i <= num_vars; ++i)
+        s.mk_var();
+}
+
+// populate a solver with a unit, binary and longer clauses and
+// return its serialized snapshot.
+static std::string mk_snapshot(random_gen& r, sat::solver& s) {
+    init_vars(s, s_num_vars);
+    sat::literal u = mk_lit(r, s_num_vars);
+    s.mk_clause(1, &u);
+    sat::literal_vector cls;
+    for (unsigned i = 0; i < 10 && !s.inconsistent(); ++i) {
+        cls.reset();
+        unsigned len = 2 + r(4);
+        for (unsigned j = 0; j < len; ++j)
+            cls.push_back(mk_lit(r, s_num_vars));
+        s.mk_clause(cls.size(), cls.data());
+    }
+    if (s.inconsistent())
+        return std::string();
+    std::stringstream strm;
+    s.save_snapshot(strm);
+    return strm.str();
+}
+
+static void tst_round_trip(unsigned seed) {
+    random_gen r(seed);
+    params_ref p;
+    reslimit rlim1, rlim2;
+    sat::solver s1(p, rlim1);
+    std::string data = mk_snapshot(r, s1);
+    if (data.empty())
+        return;
+    sat::solver s2(p, rlim2);
+    std::stringstream strm(data);
+    ENSURE(s2.restore(strm));
+    ENSURE(s1.num_vars() == s2.num_vars());
+    ENSURE(s1.init_trail_size() == s2.init_trail_size());
+    // the restored solver must answer like the original, with and
+    // without assumptions.
+    ENSURE(s1.check() == s2.check());
+    sat::literal_vector asms;
+    for (unsigned i = 0; i < 3; ++i)
+        asms.push_back(mk_lit(r, s_num_vars));
+    ENSURE(s1.check(asms) == s2.check(asms));
+}
+
+static void tst_truncated(unsigned seed) {
+    random_gen r(seed);
+    params_ref p;
+    reslimit rlim;
+    sat::solver s1(p, rlim);
+    std::string data = mk_snapshot(r, s1);
+    if (data.empty())
+        return;
+    for (size_t n : { data.size() / 4, data.size() / 2, data.size() - 1 }) {
+        reslimit rlim2;
+        sat::solver s2(p, rlim2);
+        std::stringstream strm(data.substr(0, n));
+        ENSURE(!s2.restore(strm));
+    }
+}
+
+static void put(std::ostream& out, unsigned n) {
+    out.write(reinterpret_cast<char const*>(&n), sizeof(n));
+}
+
+static void tst_bad_literal() {
+    // a syntactically complete prefix whose trail references a variable
+    // that was never declared must be rejected, not indexed.
+    std::stringstream strm;
+    put(strm, 0x5a335353); // magic
+    put(strm, 1);          // version
+    put(strm, 2);          // num_vars
+    put(strm, 0);          // flags for var 0
+    put(strm, 0);          // flags for var 1
+    put(strm, 1);          // trail size
+    put(strm, 1000);       // literal index out of range
+    params_ref p;
+    reslimit rlim;
+    sat::solver s(p, rlim);
+    ENSURE(!s.restore(strm));
+}
+
+static void tst_bad_header() {
+    params_ref p;
+    for (unsigned word : { 0u, 0x5a335352u }) {
+        std::stringstream strm;
+        put(strm, word);
+        put(strm, 1);
+        reslimit rlim;
+        sat::solver s(p, rlim);
+        ENSURE(!s.restore(strm));
+    }
+}
+
+void tst_sat_snapshot() {
+    for (unsigned seed = 0; seed < 10; ++seed) {
+        tst_round_trip(seed);
+        tst_truncated(seed);
+    }
+    tst_bad_literal();
+    tst_bad_header();
+    std::cout << "sat_snapshot: done\n";
+}
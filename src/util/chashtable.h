@@ -286,6 +286,15 @@ public:
         return m_used_slots;
     }
 
+    /**
+       \brief Grow the table upfront so that it can hold at least sz elements,
+       avoiding a cascade of expansions when the final size is known in advance.
+    */
+    void reserve(unsigned sz) {
+        while (m_capacity < sz)
+            expand_table();
+    }
+
     void insert_fresh(T const& d) {
         if (!has_free_cells()) {
             expand_table();
@@ -162,6 +162,7 @@ public:
     std::string to_string(numeral const & a) { return m().to_string(a); }
     std::string to_rational_string(numeral const & a) { return m().to_rational_string(a); }
     void display(std::ostream & out, numeral const & a) { out << to_string(a); }
+    void display_pp(std::ostream & out, numeral const & a) { display(out, a); }
     void display_decimal(std::ostream & out, numeral const & a, unsigned k) { m().display_decimal(out, a, k); }
     void display_smt2(std::ostream & out, numeral const & a, bool decimal) { m().display_smt2(out, a, decimal); }
 };
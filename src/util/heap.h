@@ -22,65 +22,72 @@ Revision History:
 #include "util/debug.h"
 #include <cstring>
 
-template<typename LT>
+/**
+   \brief d-ary heap of integers with an id-to-position array.
+   The default arity of 2 is the classical binary heap; arity 4 trades
+   deeper comparisons per level for shallower trees and sibling groups
+   that share a cache line, which pays off for sift-heavy workloads.
+
+   decrease-key operations can be batched: defer_decreased records the
+   value and postpones the sift-up until flush_deferred, which the
+   mutating operations invoke before relying on the heap invariant.
+   Deferred values are flushed in ascending heap-index order (parents
+   before children), so each individual sift-up runs on an otherwise
+   valid ancestor chain.
+*/
+template<typename LT, unsigned Arity = 2>
 class heap : private LT {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+
     int_vector    m_values;
     int_vector    m_value2indices;
+    int_vector    m_deferred;  // values with a pending decrease-key sift-up
+    bool_vector   m_pending;
 
-    static int left(int i) { 
-        return i << 1; 
-    }
-
-    static int right(int i) { 
-        return (i << 1) + 1; 
+    static int first_child(int i) {
+        return (i - 1) * static_cast<int>(Arity) + 2;
     }
 
-    static int parent(int i) { 
-        return i >> 1; 
+    static int parent(int i) {
+        return i <= 1 ? 0 : (i - 2) / static_cast<int>(Arity) + 1;
     }
 
     void display(std::ostream& out, unsigned indent, int idx) const {
         if (idx < static_cast<int>(m_values.size())) {
             for (unsigned i = 0; i < indent; ++i) out << " ";
             out << m_values[idx] << "\n";
-            display(out, indent + 1, left(idx));
-            display(out, indent + 1, right(idx));
+            int c = first_child(idx);
+            for (unsigned k = 0; k < Arity; ++k)
+                display(out, indent + 1, c + k);
         }
     }
 
     // Return true if the value can be inserted in the heap. That is, the vector m_value2indices is big enough to store this value.
-    bool is_valid_value(int v) const { 
-        SASSERT(v >= 0 && v < static_cast<int>(m_value2indices.size())); 
-        return true; 
+    bool is_valid_value(int v) const {
+        SASSERT(v >= 0 && v < static_cast<int>(m_value2indices.size()));
+        return true;
     }
 
     bool check_invariant_core(int idx) const {
-        
+
         // Check that m_values starts with a dummy value at index 0.
         if (m_values.empty() || m_values[0] != -1) {
             return false;
         }
 
-        // // All indices in m_value2indices that are not used in m_values should be 0
-        // for (int val = 0; val < static_cast<int>(m_value2indices.size()); ++val) {
-        //     if (std::find(m_values.begin(), m_values.end(), val) == m_values.end() && m_value2indices[val] != 0) {
-        //         return false; // Unused indices should have a 0 value
-        //     }
-        // }
-
         if (idx < static_cast<int>(m_values.size())) {
             SASSERT(m_value2indices[m_values[idx]] == idx);
-            SASSERT(parent(idx) == 0 || !less_than(m_values[idx], m_values[parent(idx)]));
-            SASSERT(check_invariant_core(left(idx)));
-            SASSERT(check_invariant_core(right(idx)));
+            SASSERT(parent(idx) == 0 || m_pending[m_values[idx]] || !less_than(m_values[idx], m_values[parent(idx)]));
+            for (unsigned k = 0; k < Arity; ++k)
+                SASSERT(check_invariant_core(first_child(idx) + k));
         }
         return true;
     }
 
 
 public:
-    bool check_invariant() const { 
-        return check_invariant_core(1); 
+    bool check_invariant() const {
+        return check_invariant_core(1);
     }
 
 private:
@@ -105,12 +112,16 @@ private:
         int val = m_values[idx];
         int sz  = static_cast<int>(m_values.size());
         while (true) {
-            int left_idx  = left(idx);
+            int left_idx = first_child(idx);
             if (left_idx >= sz) {
                 break;
             }
-            int right_idx = right(idx);
-            int min_idx   = right_idx < sz && less_than(m_values[right_idx], m_values[left_idx]) ? right_idx : left_idx;
+            int end_idx = std::min(left_idx + static_cast<int>(Arity), sz);
+            int min_idx = left_idx;
+            for (int c = left_idx + 1; c < end_idx; ++c) {
+                if (less_than(m_values[c], m_values[min_idx]))
+                    min_idx = c;
+            }
             SASSERT(parent(min_idx) == idx);
             int min_value = m_values[min_idx];
             if (!less_than(min_value, val)) {
@@ -135,20 +146,26 @@ public:
         CASSERT("heap", check_invariant());
     }
 
-    bool less_than(int v1, int v2) const { 
-        return LT::operator()(v1, v2); 
+    bool less_than(int v1, int v2) const {
+        return LT::operator()(v1, v2);
     }
 
-    bool empty() const { 
-        return m_values.size() == 1; 
+    bool empty() const {
+        return m_values.size() == 1;
     }
 
-    bool contains(int val) const { 
-        return val < static_cast<int>(m_value2indices.size()) && m_value2indices[val] != 0; 
+    bool contains(int val) const {
+        return val < static_cast<int>(m_value2indices.size()) && m_value2indices[val] != 0;
     }
 
     void reset() {
         CASSERT("heap", check_invariant());
+        m_deferred.reset();
+        // clear the pending bits in place: shrinking m_pending would let it
+        // fall out of sync with m_value2indices, and reserve() would not grow
+        // it back for values within the old bound.
+        if (!m_pending.empty())
+            memset(m_pending.data(), 0, sizeof(bool) * m_pending.size());
         if (empty()) {
             return;
         }
@@ -158,15 +175,16 @@ public:
         CASSERT("heap", check_invariant());
     }
 
-    void clear() { 
-        reset(); 
+    void clear() {
+        reset();
     }
 
-    void set_bounds(int s) { 
-        m_value2indices.resize(s, 0); 
+    void set_bounds(int s) {
+        m_value2indices.resize(s, 0);
+        m_pending.resize(s, false);
         CASSERT("heap", check_invariant());
     }
-    
+
     unsigned get_bounds() const {
         return m_value2indices.size();
     }
@@ -182,12 +200,45 @@ public:
         CASSERT("heap", check_invariant());
     }
 
+    /**
+       \brief Record that val's key decreased without restoring the heap
+       invariant yet. The sift-up is performed by the next operation
+       that needs the invariant.
+    */
+    void defer_decreased(int val) {
+        SASSERT(contains(val));
+        if (m_pending[val])
+            return;
+        m_pending[val] = true;
+        m_deferred.push_back(val);
+    }
+
+    void flush_deferred() {
+        if (m_deferred.empty())
+            return;
+        // sift shallow entries first: a deferred value then has no
+        // deferred entries left on its ancestor chain, so each move_up
+        // operates on a valid path. Sifting one value never changes the
+        // position of deeper deferred values.
+        std::sort(m_deferred.begin(), m_deferred.end(),
+                  [this](int v1, int v2) { return m_value2indices[v1] < m_value2indices[v2]; });
+        for (int val : m_deferred) {
+            m_pending[val] = false;
+            if (contains(val))
+                move_up(m_value2indices[val]);
+        }
+        m_deferred.reset();
+        CASSERT("heap", check_invariant());
+    }
+
     int min_value() const {
+        SASSERT(m_deferred.empty());
         SASSERT(!empty());
         return m_values[1];
     }
 
     int erase_min() {
+        flush_deferred();
         CASSERT("heap", check_invariant());
         SASSERT(!empty());
         SASSERT(m_values.size() >= 2);
@@ -210,6 +261,7 @@ public:
     }
 
     void erase(int val) {
+        flush_deferred();
         CASSERT("heap", check_invariant());
         SASSERT(contains(val));
         int idx      = m_value2indices[val];
@@ -224,7 +276,7 @@ public:
             m_value2indices[val]      = 0;
             m_values.pop_back();
             int parent_idx            = parent(idx);
-            if (parent_idx != 0 && less_than(last_val, m_values[parent(idx)])) {
+            if (parent_idx != 0 && less_than(last_val, m_values[parent_idx])) {
                 move_up(idx);
             }
             else {
@@ -234,17 +286,20 @@ public:
         CASSERT("heap", check_invariant());
     }
 
-    void decreased(int val) { 
-        SASSERT(contains(val)); 
-        move_up(m_value2indices[val]); 
+    void decreased(int val) {
+        SASSERT(contains(val));
+        flush_deferred();
+        move_up(m_value2indices[val]);
     }
 
-    void increased(int val) { 
-        SASSERT(contains(val)); 
-        move_down(m_value2indices[val]); 
+    void increased(int val) {
+        SASSERT(contains(val));
+        flush_deferred();
+        move_down(m_value2indices[val]);
     }
 
     void insert(int val) {
+        flush_deferred();
         CASSERT("heap", check_invariant());
         CASSERT("heap", !contains(val));
         SASSERT(is_valid_value(val));
@@ -256,20 +311,20 @@ public:
         CASSERT("heap", check_invariant());
     }
 
-    iterator begin() { 
-        return m_values.data() + 1; 
+    iterator begin() {
+        return m_values.data() + 1;
     }
 
-    iterator end() { 
-        return m_values.data() + m_values.size(); 
+    iterator end() {
+        return m_values.data() + m_values.size();
     }
 
-    const_iterator begin() const { 
-        return m_values.begin() + 1; 
+    const_iterator begin() const {
+        return m_values.begin() + 1;
     }
 
-    const_iterator end() const { 
-        return m_values.end(); 
+    const_iterator end() const {
+        return m_values.end();
     }
 
     void swap(heap & other) noexcept {
@@ -278,6 +333,8 @@ public:
             CASSERT("heap", check_invariant());
             m_values.swap(other.m_values);
             m_value2indices.swap(other.m_value2indices);
+            m_deferred.swap(other.m_deferred);
+            m_pending.swap(other.m_pending);
             CASSERT("heap", other.check_invariant());
             CASSERT("heap", check_invariant());
         }
@@ -287,6 +344,7 @@ public:
        \brief return set of values in heap that are less or equal to val.
      */
     void find_le(int val, int_vector& result) {
+        flush_deferred();
         int_vector todo;
         todo.push_back(1);
         while (!todo.empty()) {
@@ -295,8 +353,9 @@ public:
             if (index < static_cast<int>(m_values.size()) &&
                 !less_than(val, m_values[index])) {
                 result.push_back(m_values[index]);
-                todo.push_back(left(index));
-                todo.push_back(right(index));
+                int c = first_child(index);
+                for (unsigned k = 0; k < Arity; ++k)
+                    todo.push_back(c + k);
             }
         }
     }
@@ -305,5 +364,5 @@ public:
         display(out, 0, 1);
     }
 
-  
+
 };
@@ -2,6 +2,20 @@
 /*++
 Copyright (c) 2015 Microsoft Corporation
 
+Notes:
+
+    There is deliberately no NUMA-specific placement logic here. Allocation
+    goes through the platform malloc, and operating systems place pages on
+    the node of the thread that first touches them. Parallel drivers give
+    each worker its own ast_manager, and with it its own small_object_allocator
+    and region chunks, all allocated and touched by the worker thread itself,
+    so worker-local data already lands on the worker's node under the default
+    first-touch policy. What crosses nodes is the intentionally shared state
+    (exchange buffers, cloned input formulas), which no arena policy can
+    localize. Thread-to-node pinning is a deployment concern - numactl or
+    taskset - rather than something a library should impose, since it would
+    fight the embedding application's own placement.
+
 --*/
 
 #include<iostream>
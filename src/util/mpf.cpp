@@ -15,6 +15,20 @@ Author:
 
 Revision History:
 
+Notes:
+
+    All formats, including binary32/binary64, go through the generic mpz
+    significand path on purpose. Delegating those two formats to the host
+    FPU (as hwf does for the numeric domains, where approximation is fine)
+    would make results depend on the build target: 32-bit x87 code keeps
+    excess precision, some platforms flush subnormals to zero, NaN payload
+    handling differs, and emulating binary32 with double operations double
+    rounds near the subnormal boundary. A bit in a folded constant that
+    differs from the circuit semantics in fpa2bv is a soundness bug, not a
+    precision nit, so the portable exact path stays the only path. The
+    significands involved fit a few mpz limbs; the constant-factor cost is
+    real but the asymptotics are fine.
+
 --*/
 #include <cstring>
 #include<sstream>
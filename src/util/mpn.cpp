@@ -96,8 +96,15 @@ bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
                       mpn_digit const * b, unsigned lngb,
                       mpn_digit * c) const {
     trace(a, lnga, b, lngb, "*");
-    // Essentially Knuth's Algorithm M. 
-    // Perhaps implement a more efficient version, see e.g., Knuth, Section 4.3.3.    
+    mul_core(a, lnga, b, lngb, c);
+    trace_nl(c, lnga+lngb);
+    return true;
+}
+
+void mpn_manager::mul_school(mpn_digit const * a, unsigned lnga,
+                             mpn_digit const * b, unsigned lngb,
+                             mpn_digit * c) const {
+    // Essentially Knuth's Algorithm M.
     unsigned i;
     mpn_digit k;
 
@@ -107,7 +114,7 @@ bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
     for (unsigned i = 0; i < lnga; ++i)
         c[i] = 0;
 
-    for (unsigned j = 0; j < lngb; ++j) {        
+    for (unsigned j = 0; j < lngb; ++j) {
         mpn_digit v_j = b[j];
         if (v_j == 0) { // This branch may be omitted according to Knuth.
             c[j+lnga] = 0;
@@ -117,19 +124,110 @@ bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
             for (i = 0; i < lnga; ++i) {
                 mpn_digit u_i = a[i];
                 mpn_double_digit t;
-                t = ((mpn_double_digit)u_i * (mpn_double_digit)v_j) + 
-                    (mpn_double_digit) c[i+j] + 
+                t = ((mpn_double_digit)u_i * (mpn_double_digit)v_j) +
+                    (mpn_double_digit) c[i+j] +
                     (mpn_double_digit) k;
-                
+
                 c[i+j] = (t << DIGIT_BITS) >> DIGIT_BITS;
                 k = t >> DIGIT_BITS;
             }
             c[j+lnga] = k;
-        }        
+        }
     }
-    
-    trace_nl(c, lnga+lngb);
-    return true;
+}
+
+void mpn_manager::add_into(mpn_digit * c, unsigned lngc,
+                           mpn_digit const * a, unsigned lnga) {
+    SASSERT(lnga <= lngc);
+    mpn_double_digit k = 0;
+    unsigned i = 0;
+    for (; i < lnga; ++i) {
+        k += (mpn_double_digit) c[i] + (mpn_double_digit) a[i];
+        c[i] = (mpn_digit) k;
+        k >>= DIGIT_BITS;
+    }
+    for (; k != 0 && i < lngc; ++i) {
+        k += (mpn_double_digit) c[i];
+        c[i] = (mpn_digit) k;
+        k >>= DIGIT_BITS;
+    }
+    SASSERT(k == 0);
+}
+
+void mpn_manager::sub_from(mpn_digit * c, unsigned lngc,
+                           mpn_digit const * a, unsigned lnga) {
+    SASSERT(lnga <= lngc);
+    mpn_digit k = 0;
+    unsigned i = 0;
+    for (; i < lnga; ++i) {
+        mpn_digit r = c[i] - a[i];
+        bool c1 = r > c[i];
+        c[i] = r - k;
+        bool c2 = c[i] > r;
+        k = c1 | c2;
+    }
+    for (; k != 0 && i < lngc; ++i) {
+        mpn_digit r = c[i] - k;
+        k = r > c[i];
+        c[i] = r;
+    }
+    SASSERT(k == 0);
+}
+
+void mpn_manager::mul_core(mpn_digit const * a, unsigned lnga,
+                           mpn_digit const * b, unsigned lngb,
+                           mpn_digit * c) const {
+    if (lnga < lngb) {
+        std::swap(a, b);
+        std::swap(lnga, lngb);
+    }
+    if (lngb < KARATSUBA_THRESHOLD) {
+        mul_school(a, lnga, b, lngb, c);
+        return;
+    }
+
+    // Karatsuba: split a (and b when it reaches past the split point)
+    // at m digits. All partial products are placed either directly into
+    // disjoint slices of c or into scratch buffers that are then folded
+    // into c with a single carry-propagating addition.
+    unsigned m = (lnga + 1) / 2;
+    SASSERT(m < lnga);
+
+    if (lngb <= m) {
+        // b only overlaps the low half of a:
+        //   a * b = a1 * b * B^m + a0 * b
+        mpn_sbuffer t(lnga - m + lngb, 0);
+        mul_core(a, m, b, lngb, c);                 // c[0 .. m+lngb)
+        mul_core(a + m, lnga - m, b, lngb, t.data());
+        for (unsigned i = m + lngb; i < lnga + lngb; ++i)
+            c[i] = 0;
+        add_into(c + m, lnga + lngb - m, t.data(), t.size());
+        return;
+    }
+
+    unsigned la1 = lnga - m;
+    unsigned lb1 = lngb - m;
+
+    // z0 = a0 * b0 and z2 = a1 * b1 fill disjoint slices of c.
+    mul_core(a, m, b, m, c);                        // c[0 .. 2m)
+    mul_core(a + m, la1, b + m, lb1, c + 2 * m);    // c[2m .. lnga+lngb)
+
+    // z1 = (a0 + a1) * (b0 + b1) - z0 - z2, folded in at offset m.
+    mpn_sbuffer sa(m + 1, 0), sb(m + 1, 0);
+    unsigned lsa, lsb;
+    add(a, m, a + m, la1, sa.data(), m + 1, &lsa);
+    add(b, m, b + m, lb1, sb.data(), m + 1, &lsb);
+    // t must span the subtrahends below, not just the product: add() trims
+    // leading zero digits, so lsa + lsb can be smaller than the 2m digits of
+    // z0 that get subtracted digit by digit.
+    mpn_sbuffer t(std::max(lsa + lsb, 2 * m), 0);
+    mul_core(sa.data(), lsa, sb.data(), lsb, t.data());
+    sub_from(t.data(), t.size(), c, 2 * m);
+    sub_from(t.data(), t.size(), c + 2 * m, la1 + lb1);
+    unsigned lt = t.size();
+    while (lt > 1 && t[lt - 1] == 0)
+        lt--;
+    add_into(c + m, lnga + lngb - m, t.data(), lt);
 }
 
 #define MASK_FIRST (~((mpn_digit)(-1) >> 1))
@@ -53,6 +53,24 @@ public:
 private:
     using mpn_sbuffer = sbuffer<mpn_digit>;
 
+    // Operands whose shorter side has at least this many digits are
+    // multiplied with Karatsuba instead of the schoolbook loop.
+    static const unsigned KARATSUBA_THRESHOLD = 32;
+
+    void mul_school(mpn_digit const * a, unsigned lnga,
+                    mpn_digit const * b, unsigned lngb,
+                    mpn_digit * c) const;
+
+    void mul_core(mpn_digit const * a, unsigned lnga,
+                  mpn_digit const * b, unsigned lngb,
+                  mpn_digit * c) const;
+
+    static void add_into(mpn_digit * c, unsigned lngc,
+                         mpn_digit const * a, unsigned lnga);
+
+    static void sub_from(mpn_digit * c, unsigned lngc,
+                         mpn_digit const * a, unsigned lnga);
+
     void display_raw(std::ostream & out, mpn_digit const * a, unsigned lng) const;
 
     unsigned div_normalize(mpn_digit const * numer, unsigned lnum,
@@ -324,6 +324,13 @@ public:
 
     // d <- a + b*c
     void addmul(mpq const & a, mpq const & b, mpq const & c, mpq & d) {
+        if (is_int(a) && is_int(b) && is_int(c)) {
+            // Integer case goes through the fused mpz kernel, bypassing the
+            // temporary rational used by the general path.
+            mpz_manager<SYNCH>::addmul(a.m_num, b.m_num, c.m_num, d.m_num);
+            reset_denominator(d);
+            return;
+        }
         if (is_one(b)) {
             add(a, c, d);
         }
@@ -349,6 +356,11 @@ public:
 
     // d <- a + b*c
     void addmul(mpq const & a, mpz const & b, mpq const & c, mpq & d) {
+        if (is_int(a) && is_int(c)) {
+            mpz_manager<SYNCH>::addmul(a.m_num, b, c.m_num, d.m_num);
+            reset_denominator(d);
+            return;
+        }
         if (is_one(b)) {
             add(a, c, d);
         }
@@ -375,6 +387,11 @@ public:
 
     // d <- a - b*c
     void submul(mpq const & a, mpq const & b, mpq const & c, mpq & d) {
+        if (is_int(a) && is_int(b) && is_int(c)) {
+            mpz_manager<SYNCH>::submul(a.m_num, b.m_num, c.m_num, d.m_num);
+            reset_denominator(d);
+            return;
+        }
         if (is_one(b)) {
             sub(a, c, d);
         }
@@ -397,6 +414,11 @@ public:
 
     // d <- a - b*c
     void submul(mpq const & a, mpz const & b, mpq const & c, mpq & d) {
+        if (is_int(a) && is_int(c)) {
+            mpz_manager<SYNCH>::submul(a.m_num, b, c.m_num, d.m_num);
+            reset_denominator(d);
+            return;
+        }
         if (is_one(b)) {
             sub(a, c, d);
         }
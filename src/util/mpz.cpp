@@ -504,6 +504,12 @@ void mpz_manager<SYNCH>::mul(mpz const & a, mpz const & b, mpz & c) {
 // d <- a + b*c
 template<bool SYNCH>
 void mpz_manager<SYNCH>::addmul(mpz const & a, mpz const & b, mpz const & c, mpz & d) {
+    if (is_small(a) && is_small(b) && is_small(c)) {
+        // Small values fit in 32 bits, so |b*c| < 2^62 and the sum cannot
+        // overflow int64_t. One fused step, no temporary, no big-number path.
+        set_i64(d, i64(a) + i64(b) * i64(c));
+        return;
+    }
     if (is_one(b)) {
         add(a, c, d);
     }
@@ -522,6 +528,11 @@ void mpz_manager<SYNCH>::addmul(mpz const & a, mpz const & b, mpz const & c, mpz
 // d <- a - b*c
 template<bool SYNCH>
 void mpz_manager<SYNCH>::submul(mpz const & a, mpz const & b, mpz const & c, mpz & d) {
+    if (is_small(a) && is_small(b) && is_small(c)) {
+        // See addmul: the fused small computation is exact in int64_t.
+        set_i64(d, i64(a) - i64(b) * i64(c));
+        return;
+    }
     if (is_one(b)) {
         sub(a, c, d);
     }
@@ -609,8 +609,27 @@ inline bool operator==(rational const & a, int b) {
     return a == rational(b);
 }
 
-inline rational operator+(rational const & r1, rational const & r2) { 
-    return rational(r1) += r2; 
+inline rational operator+(rational const & r1, rational const & r2) {
+    return rational(r1) += r2;
+}
+
+// rvalue overloads recycle the storage of the temporary operand, so
+// compound expressions such as a*b + c*d do not clone mpq cells at
+// every intermediate step.
+
+inline rational operator+(rational && r1, rational const & r2) {
+    r1 += r2;
+    return std::move(r1);
+}
+
+inline rational operator+(rational const & r1, rational && r2) {
+    r2 += r1;
+    return std::move(r2);
+}
+
+inline rational operator+(rational && r1, rational && r2) {
+    r1 += r2;
+    return std::move(r1);
 }
 
 inline rational operator+(int r1, rational const & r2) {
@@ -622,8 +641,24 @@ inline rational operator+(rational const & r1, int r2) {
 }
 
 
-inline rational operator-(rational const & r1, rational const & r2) { 
-    return rational(r1) -= r2; 
+inline rational operator-(rational const & r1, rational const & r2) {
+    return rational(r1) -= r2;
+}
+
+inline rational operator-(rational && r1, rational const & r2) {
+    r1 -= r2;
+    return std::move(r1);
+}
+
+inline rational operator-(rational const & r1, rational && r2) {
+    r2.neg();
+    r2 += r1;
+    return std::move(r2);
+}
+
+inline rational operator-(rational && r1, rational && r2) {
+    r1 -= r2;
+    return std::move(r1);
 }
 
 inline rational operator-(rational const & r1, int r2) {
@@ -634,14 +669,34 @@ inline rational operator-(int r1, rational const & r2) {
     return rational(r1) - r2;
 }
 
-inline rational operator-(rational const & r) { 
-    rational result(r); 
-    result.neg(); 
-    return result; 
+inline rational operator-(rational const & r) {
+    rational result(r);
+    result.neg();
+    return result;
+}
+
+inline rational operator-(rational && r) {
+    r.neg();
+    return std::move(r);
 }
 
-inline rational operator*(rational const & r1, rational const & r2) { 
-    return rational(r1) *= r2; 
+inline rational operator*(rational const & r1, rational const & r2) {
+    return rational(r1) *= r2;
+}
+
+inline rational operator*(rational && r1, rational const & r2) {
+    r1 *= r2;
+    return std::move(r1);
+}
+
+inline rational operator*(rational const & r1, rational && r2) {
+    r2 *= r1;
+    return std::move(r2);
+}
+
+inline rational operator*(rational && r1, rational && r2) {
+    r1 *= r2;
+    return std::move(r1);
 }
 
 inline rational operator*(rational const & r1, bool r2) {
@@ -660,8 +715,13 @@ inline rational operator*(int  r1, rational const & r2) {
     return rational(r1) * r2;
 }
 
-inline rational operator/(rational const & r1, rational const & r2) { 
-    return rational(r1) /= r2; 
+inline rational operator/(rational const & r1, rational const & r2) {
+    return rational(r1) /= r2;
+}
+
+inline rational operator/(rational && r1, rational const & r2) {
+    r1 /= r2;
+    return std::move(r1);
 }
 
 inline rational operator/(rational const & r1, int r2) {
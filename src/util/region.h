@@ -88,6 +88,23 @@ public:
 
 #endif
 
+/**
+   \brief RAII mark for region scopes: push_scope on construction,
+   pop_scope on destruction. Lets several phases of a pipeline share one
+   region - each phase allocates arena-style inside its own scope and
+   releases in O(1) on exit, while the region keeps its pages for the
+   next phase instead of returning them to the memory manager the way
+   reset() does.
+*/
+class region_scope {
+    region & m_region;
+public:
+    region_scope(region & r):m_region(r) { m_region.push_scope(); }
+    region_scope(region_scope const &) = delete;
+    region_scope & operator=(region_scope const &) = delete;
+    ~region_scope() { m_region.pop_scope(); }
+};
+
 inline void * operator new(size_t s, region & r) { return r.allocate(s); }
 
 inline void * operator new[](size_t s, region & r) { return r.allocate(s); }
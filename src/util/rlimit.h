@@ -92,6 +92,14 @@ public:
     void auto_cancel();
 };
 
+// Budgets are hierarchical already: push(delta) sets the effective limit to
+// the minimum of the caller's remaining budget and the parent's, so a nested
+// engine can only subdivide what is left, and pop() charges the consumed
+// ticks back to the parent. Cancellation reaches nested engines with their
+// own reslimit through push_child. Latency between a cancel and its effect
+// is bounded by the distance between inc()/not_canceled() polling points in
+// the running kernel - long-running kernels such as polynomial.cpp call
+// checkpoint() at their loop heads for this reason.
 class scoped_rlimit {
     reslimit& m_limit;
 public:
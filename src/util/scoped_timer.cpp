@@ -17,6 +17,18 @@ Revision History:
 
     Nuno Lopes (nlopes) 2019-02-04  - use C++11 goodies
 
+Notes:
+
+    Worker threads are pooled: after warm-up, arming a timer pops an idle
+    worker, fills in the deadline and handler, and signals its condition
+    variable - no thread creation or heap allocation per solver call. The
+    destructor's handshake on the timed mutex is what guarantees the
+    handler is never invoked after the scoped_timer dies; a shared timer
+    wheel would need an equivalent per-entry deregistration barrier and so
+    would not remove the synchronization, only move it. Builds with
+    POLLING_TIMER avoid timer threads altogether for reslimit-based
+    handlers by folding the deadline into the cancellation polling.
+
 --*/
 
 #include "util/scoped_timer.h"
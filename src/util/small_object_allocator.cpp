@@ -29,6 +29,9 @@ Revision History:
 #endif
 
 
+// Consolidation is not worth running below this amount of free-list waste.
+#define MIN_CONSOLIDATE_SIZE (1ull << 20)
+
 small_object_allocator::small_object_allocator(char const * id) {
     for (unsigned i = 0; i < NUM_SLOTS; ++i) {
         m_chunks[i] = nullptr;
@@ -38,6 +41,8 @@ small_object_allocator::small_object_allocator(char const * id) {
         m_id = id;
     });
     m_alloc_size = 0;
+    m_free_size  = 0;
+    m_consolidate_threshold = MIN_CONSOLIDATE_SIZE;
 }
 
 small_object_allocator::~small_object_allocator() {
@@ -68,6 +73,8 @@ void small_object_allocator::reset() {
         m_free_list[i] = nullptr;
     }
     m_alloc_size = 0;
+    m_free_size  = 0;
+    m_consolidate_threshold = MIN_CONSOLIDATE_SIZE;
 }
 
 #define MASK ((1 << PTR_ALIGNMENT) - 1)
@@ -95,6 +102,13 @@ void small_object_allocator::deallocate(size_t size, void * p) {
     SASSERT(slot_id < NUM_SLOTS);
     *(reinterpret_cast<void**>(p)) = m_free_list[slot_id];
     m_free_list[slot_id] = p;
+    m_free_size += slot_id << PTR_ALIGNMENT;
+    // Reclaim fully-free chunks once the free lists hold more memory than
+    // the live objects. The threshold is doubled after each attempt, so a
+    // workload whose chunks cannot be freed does not re-scan on every
+    // deallocation.
+    if (m_free_size >= m_consolidate_threshold && m_free_size > m_alloc_size)
+        consolidate();
 }
 
 
@@ -125,6 +139,7 @@ void * small_object_allocator::allocate(size_t size) {
     if (m_free_list[slot_id] != nullptr) {
         void * r = m_free_list[slot_id];
         m_free_list[slot_id] = *(reinterpret_cast<void **>(r));
+        m_free_size -= slot_id << PTR_ALIGNMENT;
         return r;
     }
     chunk * c = m_chunks[slot_id]; 
@@ -244,7 +259,9 @@ void small_object_allocator::consolidate() {
         m_chunks[slot_id]    = last_chunk;
         m_free_list[slot_id] = last_free_obj;
     }
-    IF_VERBOSE(CONSOLIDATE_VB_LVL, 
+    m_free_size = get_wasted_size();
+    m_consolidate_threshold = std::max(2 * m_free_size, static_cast<size_t>(MIN_CONSOLIDATE_SIZE));
+    IF_VERBOSE(CONSOLIDATE_VB_LVL,
                verbose_stream() << "(end-allocator-consolidate :wasted-size " << get_wasted_size() 
                << " :memory " << std::fixed << std::setprecision(2) 
                << static_cast<double>(memory::get_allocation_size())/static_cast<double>(1024*1024) << ")" << std::endl;);
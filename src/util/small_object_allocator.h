@@ -35,6 +35,8 @@ class small_object_allocator {
     chunk *     m_chunks[NUM_SLOTS];
     void  *     m_free_list[NUM_SLOTS];
     size_t      m_alloc_size;
+    size_t      m_free_size;             // bytes sitting on the free lists
+    size_t      m_consolidate_threshold; // free-size watermark that triggers consolidation
 #ifdef Z3DEBUG
     char const * m_id;
 #endif
@@ -45,6 +47,8 @@ public:
     void * allocate(size_t size);
     void deallocate(size_t size, void * p);
     size_t get_allocation_size() const { return m_alloc_size; }
+    // O(1) count of bytes on the free lists (get_wasted_size walks them).
+    size_t get_free_size() const { return m_free_size; }
     size_t get_wasted_size() const;
     size_t get_num_free_objs() const;
     void consolidate();
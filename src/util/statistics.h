@@ -15,6 +15,16 @@ Author:
 
 Notes:
 
+    Counters are aggregated at the end of a check on purpose. A query runs
+    on the caller's thread and API contexts are single-threaded, so there
+    is no safe point at which another thread could drain a mid-run sample
+    buffer through Z3_get_statistics while the engines mutate their
+    counters. The supported way to see where a long-running query spends
+    its time is the verbose progress output: each engine emits phase-tagged
+    status lines (restarts, conflicts, memory, per-theory activity) at
+    verbosity >= 1, which can be timestamped externally without adding
+    instrumentation to the search loops.
+
 --*/
 #pragma once
 
@@ -235,6 +235,59 @@ inline std::ostream & operator<<(std::ostream & target, const uint_set & s) {
 }
 
 
+/**
+   \brief Set of unsigned integers with constant-time reset. Each element
+   is stamped with the epoch in which it was inserted; reset() bumps the
+   epoch, invalidating every stamp at once, and the stamp array is only
+   cleared when the epoch counter wraps around. Intended for scratch sets
+   that are cleared much more often than they are filled. Does not support
+   iteration; use tracked_uint_set when elements need to be enumerated.
+*/
+class stamped_uint_set {
+    unsigned_vector m_stamps;
+    unsigned        m_epoch = 1;
+    unsigned        m_size  = 0;
+public:
+    void insert(unsigned v) {
+        m_stamps.reserve(v + 1, 0);
+        if (m_stamps[v] != m_epoch) {
+            m_stamps[v] = m_epoch;
+            m_size++;
+        }
+    }
+
+    void remove(unsigned v) {
+        if (contains(v)) {
+            m_stamps[v] = 0;
+            m_size--;
+        }
+    }
+
+    bool contains(unsigned v) const {
+        return v < m_stamps.size() && m_stamps[v] == m_epoch;
+    }
+
+    bool empty() const { return m_size == 0; }
+
+    unsigned size() const { return m_size; }
+
+    void reset() {
+        m_size = 0;
+        if (++m_epoch == 0) {
+            // the epoch counter wrapped around: stale stamps would become
+            // ambiguous, so pay for one full clear.
+            m_stamps.reset();
+            m_epoch = 1;
+        }
+    }
+
+    void finalize() {
+        m_stamps.finalize();
+        m_epoch = 1;
+        m_size = 0;
+    }
+};
+
 class tracked_uint_set {
     svector<char>        m_in_set;
     svector<unsigned>    m_set;
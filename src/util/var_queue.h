@@ -30,15 +30,18 @@ class var_queue {
         lt(ActivityVector & act):m_activity(act) {}
         bool operator()(var v1, var v2) const { return m_activity[v1] > m_activity[v2]; }
     };
-    heap<lt>  m_queue;
+    // 4-ary: conflict analysis bumps activities far more often than it
+    // pops variables, so flatter trees and cache-line sized sibling
+    // groups beat the binary layout here.
+    heap<lt, 4>  m_queue;
 
 public:
-    
+
     var_queue(ActivityVector & act):m_queue(128, lt(act)) {}
-    
+
     void activity_increased_eh(var v) {
         if (m_queue.contains(v))
-            m_queue.decreased(v);
+            m_queue.defer_decreased(v);
     }
     
     void activity_changed_eh(var v, bool up) {
@@ -75,7 +78,7 @@ public:
     
     var next_var() { SASSERT(!empty()); return m_queue.erase_min(); }
     
-    var min_var() { SASSERT(!empty()); return m_queue.min_value(); }
+    var min_var() { SASSERT(!empty()); m_queue.flush_deferred(); return m_queue.min_value(); }
     
     bool more_active(var v1, var v2) const { return m_queue.less_than(v1, v2); }
 